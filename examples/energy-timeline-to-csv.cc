@@ -0,0 +1,45 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+/*
+ * Convert an energy timeline recorded by EnergyTimelineRecorder to CSV.
+ *
+ *   ./waf --run "energy-timeline-to-csv --input=energy-timeline.bin --output=energy-timeline.csv"
+ */
+
+#include "ns3/energy-timeline-recorder.h"
+#include "ns3/command-line.h"
+
+using namespace ns3;
+using namespace sigfox;
+
+int
+main (int argc, char *argv[])
+{
+  std::string input = "energy-timeline.bin";
+  std::string output = "energy-timeline.csv";
+
+  CommandLine cmd;
+  cmd.AddValue ("input", "The recorded energy timeline", input);
+  cmd.AddValue ("output", "The CSV file to write", output);
+  cmd.Parse (argc, argv);
+
+  EnergyTimelineRecorder::ConvertToCsv (input, output);
+
+  return 0;
+}
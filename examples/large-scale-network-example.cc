@@ -24,6 +24,7 @@
 #include "ns3/end-point-sigfox-phy.h"
 #include "ns3/gateway-sigfox-phy.h"
 #include "ns3/gateway-sigfox-mac.h"
+#include "ns3/downlink-scheduler.h"
 #include "ns3/sigfox-tag.h"
 #include "ns3/simulator.h"
 #include "ns3/log.h"
@@ -43,6 +44,8 @@
 #include "ns3/sigfox-radio-energy-model-helper.h"
 #include "ns3/sdc-energy-source-helper.h"
 #include "ns3/sdc-energy-source.h"
+#include "ns3/periodic-load-energy-model-helper.h"
+#include "ns3/gateway-energy-model-helper.h"
 #include "ns3/config.h"
 #include "ns3/names.h"
 #include <algorithm>
@@ -59,6 +62,8 @@ using namespace sigfox;
 NS_LOG_COMPONENT_DEFINE ("EnergyModelExample");
 int nDevices = 1;
 int nGateways = 1;
+// One message in bdpf requests a downlink reply, 0 disables downlinks
+int bdpf = 0;
 
 const int day = 86400;
 // const int TotalTime = 2000; //4*day;
@@ -70,16 +75,34 @@ uint32_t numberofmeasurments = 0;
 
 int appPeriodSeconds = TotalTime;
 double battery = 100 * 60 * 60;
-double EnergyConsumptionMeasurment = 0;
+// The consumption of one sensor measurement
+const double measurementConsumption = 32.2;
+// Whether the measurements drain the battery, through a PeriodicLoadEnergyModel
+bool drainMeasurements = false;
+Ptr<PeriodicLoadEnergyModel> measurementLoad;
 double EnergyConsumptionNode = 0;
 double TotalRemainingEnergy = 0;
 
 
+// The consumption of the measurements taken so far, one per minute from the
+// first minute on
+double
+MeasurementConsumption (void)
+{
+  if (measurementLoad != 0)
+    {
+      return measurementLoad->GetTotalEnergyConsumption ();
+    }
+  // The measurement of a minute is taken after the battery level is printed
+  int64_t minutes = Simulator::Now ().GetTimeStep () / Minutes (1).GetTimeStep ();
+  return std::max<int64_t> (minutes - 1, 0) * measurementConsumption;
+}
+
 void
 Print (void)
 {
   if (TotalRemainingEnergy >= 0)
-    TotalRemainingEnergy = battery - EnergyConsumptionNode - EnergyConsumptionMeasurment;
+    TotalRemainingEnergy = battery - EnergyConsumptionNode - MeasurementConsumption ();
   if (TotalRemainingEnergy <= 0)
     TotalRemainingEnergy = 0;
   // NS_LOG_UNCOND ( TotalRemainingEnergy << "   " <<EnergyConsumptionNode <<  "   " << EnergyConsumptionMeasurment);
@@ -115,31 +138,6 @@ TotalEnergy (double oldValue, double totalEnergy)
   EnergyConsumptionNode = totalEnergy;
 }
 
-void
-Measure ()
-{
-  //NS_LOG_UNCOND (Simulator::Now ().GetSeconds () << "Node 0 Measures a Value");
-  //NS_LOG_UNCOND ("Old value"<<EnergyConsumptionMeasurment<<"Simulation time"<<Simulator::Now ().GetSeconds () );
-  EnergyConsumptionMeasurment += 32.2;
-  //numberofmeasurments += 1;
-  Simulator::Schedule (Seconds (60.0), &Measure);
-  //NS_LOG_UNCOND ("new value"<<EnergyConsumptionMeasurment<<"Simulation time"<<Simulator::Now ().GetSeconds () );
-}
-
-void
-SelfDischarge ()
-{
-  NS_LOG_UNCOND ("Old value" << TotalRemainingEnergy << "Simulation time"
-                             << Simulator::Now ().GetSeconds ());
-  TotalRemainingEnergy =
-      TotalRemainingEnergy -
-      0.02 * (TotalRemainingEnergy / (30 * day)) *
-          day; //EnergyConsumptionSelfDischarge += 5.4;     // battery[id]=battery[id]−sdc_rate[id]∗(battery[id]/sdc_time[id])∗1∗day
-  //numberofmeasurments += 1;
-  //NS_LOG_UNCOND ("new value"<<TotalRemainingEnergy<<"Simulation tvoidime"<<Simulator::Now ().GetSeconds () );
-  Simulator::Schedule (Seconds (86400.0), &SelfDischarge);
-}
-
 void
 PacketSentOnChannel (Ptr<const Packet> packet)
 {
@@ -265,9 +263,16 @@ main (int argc, char *argv[])
   LogComponentEnableAll (LOG_PREFIX_NODE);
   LogComponentEnableAll (LOG_PREFIX_TIME);
 
+  bool currentGraph = false;
+
   CommandLine cmd;
   cmd.AddValue ("nDevices", "Number of Sigfox End Points to simulate", nDevices);
   cmd.AddValue ("nRepetitions", "Number of repetitions", nRepetitions);
+  cmd.AddValue ("bdpf", "One message in bdpf requests a downlink, 0 for none", bdpf);
+  cmd.AddValue ("drainMeasurements", "Drain the sensor measurements from the battery",
+                drainMeasurements);
+  cmd.AddValue ("currentGraph", "Trace the current of the first device to CurrentGraph.txt",
+                currentGraph);
   cmd.Parse (argc, argv);
 
   Config::SetDefault("ns3::EndPointSigfoxMac::Repetitions", IntegerValue(nRepetitions));
@@ -346,10 +351,15 @@ main (int argc, char *argv[])
   mobility.SetPositionAllocator (allocator);
   mobility.Install (gateways);
 
+  // The network server answers the bidirectional procedure through the
+  // gateways
+  Ptr<DownlinkScheduler> downlinkScheduler = CreateObject<DownlinkScheduler> ();
+  macHelper.SetDownlinkScheduler (downlinkScheduler);
+
   // Create a netdevice for each gateway
   phyHelper.SetDeviceType (SigfoxPhyHelper::GW);
   macHelper.SetDeviceType (SigfoxMacHelper::GW);
-  helper.Install (phyHelper, macHelper, gateways);
+  NetDeviceContainer gatewayNetDevices = helper.Install (phyHelper, macHelper, gateways);
 
   // Connect trace sources to keep track of packets
   gateways.Get (0)->GetDevice (0)->GetObject<SigfoxNetDevice> ()->GetPhy ()->TraceConnectWithoutContext("ReceivedPacket", MakeCallback(&ReceivedPacketAtGateway));
@@ -365,6 +375,8 @@ main (int argc, char *argv[])
   // configure energy source
   basicSourceHelper.Set ("SdcEnergySourceInitialEnergyJ", DoubleValue (3600)); // Energy in J
   basicSourceHelper.Set ("SdcEnergySupplyVoltageV", DoubleValue (3.3));
+  // 2% of the energy is lost to self-discharge every month
+  basicSourceHelper.Set ("SdcSelfDischargeParameter", DoubleValue (0.98));
 
   radioEnergyHelper.Set ("StandbyCurrentA", DoubleValue (0.0043));
   radioEnergyHelper.Set ("TxCurrentA", DoubleValue (0.047));
@@ -382,12 +394,25 @@ main (int argc, char *argv[])
   DeviceEnergyModelContainer deviceModels =
       radioEnergyHelper.Install (endDevicesNetDevices, sources);
 
+  if (drainMeasurements)
+    {
+      // A sensor measurement every minute, drawing 32.2 J over 4.9 s
+      PeriodicLoadEnergyModelHelper loadHelper;
+      loadHelper.Set ("Period", TimeValue (Seconds (60)));
+      loadHelper.Set ("Offset", TimeValue (Seconds (60)));
+      loadHelper.Set ("PulseDuration", TimeValue (Seconds (4.9)));
+      loadHelper.Set ("PulseCurrentA", DoubleValue (measurementConsumption / (3.3 * 4.9)));
+      DeviceEnergyModelContainer loadModels = loadHelper.Install (endDevicesNetDevices, sources);
+      measurementLoad = DynamicCast<PeriodicLoadEnergyModel> (loadModels.Get (0));
+    }
+
   /*********************************************************************************/
 
   Time appStopTime = Seconds (simulationTime);
   PeriodicSenderHelper appHelper = PeriodicSenderHelper ();
   appHelper.SetPeriod (Seconds (60)); //appPeriodSeconds));
   appHelper.SetPacketSize (12);
+  appHelper.SelectBDPFrequency (bdpf);
   //Ptr<RandomVariableStream> rv = CreateObjectWithAttributes<UniformRandomVariable> ( "Min", DoubleValue (10), "Max", DoubleValue (10));
   ApplicationContainer appContainer = appHelper.Install (endDevices);
 
@@ -408,7 +433,19 @@ main (int argc, char *argv[])
   basicRadioModelPtr->TraceConnectWithoutContext ("TotalEnergyConsumption",
                                                   MakeCallback (&TotalEnergy));
 
-  basicRadioModelPtr->TraceConnectWithoutContext ("SystemCurrent", MakeCallback (&syscurrent));
+  if (currentGraph)
+    {
+      basicRadioModelPtr->TraceConnectWithoutContext ("SystemCurrent", MakeCallback (&syscurrent));
+    }
+
+  // Time and energy per radio state, written at the end of the run
+  SigfoxRadioEnergyModelHelper::EnableStateCountersDump (deviceModels, "EnergyBreakdown.csv");
+
+  // Power drawn by the gateways, from their reception and transmission
+  // counters
+  GatewayEnergyModelHelper gatewayEnergyHelper;
+  DeviceEnergyModelContainer gatewayModels = gatewayEnergyHelper.Install (gatewayNetDevices);
+  GatewayEnergyModelHelper::EnableEnergyDump (gatewayModels, "GatewayEnergy.csv");
 
   /**************
    * Get output File *
@@ -426,8 +463,6 @@ main (int argc, char *argv[])
   NS_LOG_INFO ("Running simulation...");
   Print ();
 
-  Simulator::Schedule (Seconds (60.0), &Measure);
-  Simulator::Schedule (Seconds (86400.0), &SelfDischarge);
   Simulator::Run ();
 
   Simulator::Destroy ();
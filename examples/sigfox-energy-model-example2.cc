@@ -43,6 +43,8 @@
 #include "ns3/sigfox-radio-energy-model-helper.h"
 #include "ns3/sdc-energy-source-helper.h"
 #include "ns3/sdc-energy-source.h"
+#include "ns3/periodic-load-energy-model-helper.h"
+#include "ns3/energy-timeline-recorder.h"
 #include <algorithm>
 #include <ctime>
 #include "ns3/periodic-sender.h"
@@ -68,36 +70,45 @@ uint32_t numberofmeasurments = 0;
 
 int appPeriodSeconds = TotalTime;
 double battery = 10000 * 60 * 60;  // 10000mAh   ..... converted into mAs
-double EnergyConsumptionMeasurment = 0;
+// The consumption of one sensor measurement
+const double measurementConsumption = 5.8 * 4.9;
+// Whether the measurements drain the battery, through a PeriodicLoadEnergyModel
+bool drainMeasurements = false;
+Ptr<PeriodicLoadEnergyModel> measurementLoad;
 //double EnergyConsumptionSelfDischarge =0;
 double EnergyConsumptionNode = 0;
 double TotalRemainingEnergy = 0;
 
+
+// The consumption of the measurements taken so far, one per minute from the
+// first minute on
+double
+MeasurementConsumption (void)
+{
+  if (measurementLoad != 0)
+    {
+      return measurementLoad->GetTotalEnergyConsumption ();
+    }
+  // The measurement of a minute is taken after the battery level is printed
+  int64_t minutes = Simulator::Now ().GetTimeStep () / Minutes (1).GetTimeStep ();
+  return std::max<int64_t> (minutes - 1, 0) * measurementConsumption;
+}
+
 //______________________Print Data________________________________
 void
 Print (void)
 {
   if (TotalRemainingEnergy >= 0)
-    TotalRemainingEnergy = battery - EnergyConsumptionNode - EnergyConsumptionMeasurment;
+    TotalRemainingEnergy = battery - EnergyConsumptionNode - MeasurementConsumption ();
   if (TotalRemainingEnergy <= 0)
     TotalRemainingEnergy = 0;
  // NS_LOG_UNCOND ( battery<<"    "<<TotalRemainingEnergy << "   " <<EnergyConsumptionNode <<  "   " << EnergyConsumptionMeasurment);
-  std::ofstream out ("BatteryLevel.txt", std::ios::app);
-  out << (Simulator::Now ()).GetSeconds () << " , " << TotalRemainingEnergy << "" << std::endl;
-  out.close ();
+  // Opened once, and flushed when the program exits
+  static std::ofstream out ("BatteryLevel.txt", std::ios::app);
+  out << (Simulator::Now ()).GetSeconds () << " , " << TotalRemainingEnergy << "\n";
   Simulator::Schedule (Seconds (60.0), &Print);
 }
 
-void
-syscurrent (double y, double x)
-{
-    //NS_LOG_UNCOND ("  hahahahahaha " );
-  std::ofstream out ("CurrentGraph.txt", std::ios::app);
-  out << (Simulator::Now ()).GetSeconds () << " " << y << std::endl;
-  out << (Simulator::Now ()).GetSeconds () << " " << x << std::endl;
-  out.close ();
-}
-
 //________________________________________________________________
 /// Trace function for remaining energy at node.
 void
@@ -114,30 +125,6 @@ TotalEnergy (double oldValue, double totalEnergy)
   //NS_LOG_UNCOND (Simulator::Now ().GetSeconds () << "s Total energy consumed by radio = " << totalEnergy << "J");
   EnergyConsumptionNode = totalEnergy;
 }
-//______________________Measuring value___________________________
-void
-Measure ()
-{
-  //NS_LOG_UNCOND (Simulator::Now ().GetSeconds () << "Node 0 Measures a Value");
-  //NS_LOG_UNCOND ("Old value"<<EnergyConsumptionMeasurment<<"Simulation time"<<Simulator::Now ().GetSeconds () );
-  EnergyConsumptionMeasurment += 5.8*4.9;// Measure current * measure time
-  //numberofmeasurments += 1;
-  Simulator::Schedule (Seconds (60.0), &Measure);
-  //NS_LOG_UNCOND ("new value"<<EnergyConsumptionMeasurment<<"Simulation time"<<Simulator::Now ().GetSeconds () );
-}
-//______________________Measuring value___________________________
-void
-SelfDischarge ()
-{
-  //NS_LOG_UNCOND ("Old value" << TotalRemainingEnergy << "Simulation time"
-                             //<< Simulator::Now ().GetSeconds ());
-  TotalRemainingEnergy =
-      TotalRemainingEnergy -
-      0.02 * (TotalRemainingEnergy / (30 * day)) *
-          day; //EnergyConsumptionSelfDischarge += 5.4;     // battery[id]=battery[id]−sdc_rate[id]∗(battery[id]/sdc_time[id])∗1∗day
-  Simulator::Schedule (Seconds (86400.0), &SelfDischarge);
-}
-
 int
 main (int argc, char *argv[])
 {
@@ -174,6 +161,12 @@ main (int argc, char *argv[])
     LogComponentEnableAll (LOG_PREFIX_FUNC);
     LogComponentEnableAll (LOG_PREFIX_NODE);
     LogComponentEnableAll (LOG_PREFIX_TIME);
+
+  CommandLine cmd;
+  cmd.AddValue ("drainMeasurements", "Drain the sensor measurements from the battery",
+                drainMeasurements);
+  cmd.Parse (argc, argv);
+
   /************************
   *  Create the channel  *
   ************************/
@@ -259,6 +252,8 @@ main (int argc, char *argv[])
   // configure energy source
   basicSourceHelper.Set ("SdcEnergySourceInitialEnergyJ", DoubleValue (36000000)); // Energy in J
   basicSourceHelper.Set ("SdcEnergySupplyVoltageV", DoubleValue (3.3));
+  // 2% of the energy is lost to self-discharge every month
+  basicSourceHelper.Set ("SdcSelfDischargeParameter", DoubleValue (0.98));
 
   radioEnergyHelper.Set ("StandbyCurrentA", DoubleValue (0.0108));
   //radioEnergyHelper.Set ("TxCurrentA", DoubleValue (28000));
@@ -277,6 +272,18 @@ main (int argc, char *argv[])
   DeviceEnergyModelContainer deviceModels =
       radioEnergyHelper.Install (endDevicesNetDevices, sources);
 
+  if (drainMeasurements)
+    {
+      // A sensor measurement every minute, drawing 5.8 for 4.9 s
+      PeriodicLoadEnergyModelHelper loadHelper;
+      loadHelper.Set ("Period", TimeValue (Seconds (60)));
+      loadHelper.Set ("Offset", TimeValue (Seconds (60)));
+      loadHelper.Set ("PulseDuration", TimeValue (Seconds (4.9)));
+      loadHelper.Set ("PulseCurrentA", DoubleValue (5.8));
+      DeviceEnergyModelContainer loadModels = loadHelper.Install (endDevicesNetDevices, sources);
+      measurementLoad = DynamicCast<PeriodicLoadEnergyModel> (loadModels.Get (0));
+    }
+
   /*********************************************************************************/
 
   Time appStopTime = Seconds (simulationTime);
@@ -303,7 +310,10 @@ main (int argc, char *argv[])
   basicRadioModelPtr->TraceConnectWithoutContext ("TotalEnergyConsumption",
                                                   MakeCallback (&TotalEnergy));
 
-  basicRadioModelPtr->TraceConnectWithoutContext ("SystemCurrent", MakeCallback (&syscurrent));
+  // The current and energy timeline of the device, for plotting: convert
+  // it with energy-timeline-to-csv
+  Ptr<EnergyTimelineRecorder> recorder = CreateObject<EnergyTimelineRecorder> ();
+  recorder->Add (sources);
 
   /****************
   *  Simulation  *
@@ -314,8 +324,6 @@ main (int argc, char *argv[])
   NS_LOG_INFO ("Running simulation...");
   Print ();
 
-  Simulator::Schedule (Seconds (60.0), &Measure);
-  Simulator::Schedule (Seconds (86400.0), &SelfDischarge);
   Simulator::Run ();
 
   Simulator::Destroy ();
@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/fleet-energy-ledger-helper.h"
+#include "ns3/sigfox-net-device.h"
+#include "ns3/end-point-sigfox-phy.h"
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("FleetEnergyLedgerHelper");
+
+FleetEnergyLedgerHelper::FleetEnergyLedgerHelper ()
+{
+  m_factory.SetTypeId ("ns3::FleetEnergyLedger");
+}
+
+FleetEnergyLedgerHelper::~FleetEnergyLedgerHelper ()
+{
+}
+
+void
+FleetEnergyLedgerHelper::Set (std::string name, const AttributeValue &value)
+{
+  NS_ASSERT_MSG (m_ledger == 0, "The ledger was already created");
+  m_factory.Set (name, value);
+}
+
+DeviceEnergyModelContainer
+FleetEnergyLedgerHelper::Install (NetDeviceContainer devices)
+{
+  DeviceEnergyModelContainer models;
+  for (NetDeviceContainer::Iterator i = devices.Begin (); i != devices.End (); ++i)
+    {
+      models.Add (Install (*i));
+    }
+  return models;
+}
+
+DeviceEnergyModelContainer
+FleetEnergyLedgerHelper::Install (Ptr<NetDevice> device)
+{
+  NS_LOG_FUNCTION (this << device);
+
+  Ptr<SigfoxNetDevice> sigfoxDevice = DynamicCast<SigfoxNetDevice> (device);
+  if (sigfoxDevice == 0)
+    {
+      NS_FATAL_ERROR ("NetDevice type is not SigfoxNetDevice!");
+    }
+  Ptr<EndPointSigfoxPhy> phy = DynamicCast<EndPointSigfoxPhy> (sigfoxDevice->GetPhy ());
+  NS_ABORT_MSG_IF (phy == 0, "The ledger only keeps the batteries of end points");
+
+  if (m_ledger == 0)
+    {
+      m_ledger = m_factory.Create<FleetEnergyLedger> ();
+    }
+
+  Ptr<LedgerRadioEnergyModel> model = CreateObject<LedgerRadioEnergyModel> ();
+  model->Attach (m_ledger, phy);
+
+  return DeviceEnergyModelContainer (model);
+}
+
+Ptr<FleetEnergyLedger>
+FleetEnergyLedgerHelper::GetLedger (void) const
+{
+  return m_ledger;
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,81 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef FLEET_ENERGY_LEDGER_HELPER_H
+#define FLEET_ENERGY_LEDGER_HELPER_H
+
+#include "ns3/object-factory.h"
+#include "ns3/attribute.h"
+#include "ns3/net-device-container.h"
+#include "ns3/device-energy-model-container.h"
+#include "ns3/fleet-energy-ledger.h"
+#include <string>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * This class can be used to keep the batteries of SigfoxNetDevices in a
+ * single FleetEnergyLedger, instead of installing an SdcEnergySource and a
+ * SigfoxRadioEnergyModel on each of them.
+ *
+ * All devices installed by the same helper share the same ledger, that is
+ * created by the first call to Install.
+ */
+class FleetEnergyLedgerHelper
+{
+public:
+  FleetEnergyLedgerHelper ();
+
+  ~FleetEnergyLedgerHelper ();
+
+  /**
+   * Set an attribute of the ledger. This must be done before the first call
+   * to Install.
+   *
+   * \param name The name of the attribute.
+   * \param value The value of the attribute.
+   */
+  void Set (std::string name, const AttributeValue &value);
+
+  /**
+   * \param devices The SigfoxNetDevices of end points.
+   * \return The LedgerRadioEnergyModels of the devices.
+   */
+  DeviceEnergyModelContainer Install (NetDeviceContainer devices);
+
+  /**
+   * \param device The SigfoxNetDevice of an end point.
+   * \return The LedgerRadioEnergyModel of the device.
+   */
+  DeviceEnergyModelContainer Install (Ptr<NetDevice> device);
+
+  /**
+   * \return The ledger, or 0 if Install was never called.
+   */
+  Ptr<FleetEnergyLedger> GetLedger (void) const;
+
+private:
+  ObjectFactory m_factory;          //!< The factory of the ledger
+  Ptr<FleetEnergyLedger> m_ledger;  //!< The ledger shared by the devices
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* FLEET_ENERGY_LEDGER_HELPER_H */
@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/gateway-energy-model-helper.h"
+#include "ns3/sigfox-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/abort.h"
+#include <fstream>
+
+namespace ns3 {
+namespace sigfox {
+
+GatewayEnergyModelHelper::GatewayEnergyModelHelper ()
+{
+  m_gatewayEnergy.SetTypeId ("ns3::GatewayEnergyModel");
+}
+
+GatewayEnergyModelHelper::~GatewayEnergyModelHelper ()
+{
+}
+
+void
+GatewayEnergyModelHelper::Set (std::string name, const AttributeValue &v)
+{
+  m_gatewayEnergy.Set (name, v);
+}
+
+Ptr<GatewayEnergyModel>
+GatewayEnergyModelHelper::Install (Ptr<NetDevice> device) const
+{
+  NS_ASSERT (device != 0);
+
+  Ptr<SigfoxNetDevice> sigfoxDevice = device->GetObject<SigfoxNetDevice> ();
+  if (sigfoxDevice == 0)
+    {
+      NS_FATAL_ERROR ("NetDevice type is not SigfoxNetDevice!");
+    }
+  Ptr<GatewaySigfoxPhy> phy = sigfoxDevice->GetPhy ()->GetObject<GatewaySigfoxPhy> ();
+  if (phy == 0)
+    {
+      NS_FATAL_ERROR ("SigfoxNetDevice is not a gateway!");
+    }
+
+  Ptr<GatewayEnergyModel> model = m_gatewayEnergy.Create<GatewayEnergyModel> ();
+  model->SetPhy (phy);
+  return model;
+}
+
+DeviceEnergyModelContainer
+GatewayEnergyModelHelper::Install (NetDeviceContainer devices) const
+{
+  DeviceEnergyModelContainer models;
+  for (NetDeviceContainer::Iterator i = devices.Begin (); i != devices.End (); ++i)
+    {
+      models.Add (Install (*i));
+    }
+  return models;
+}
+
+double
+GatewayEnergyModelHelper::GetTotalEnergyConsumption (DeviceEnergyModelContainer models)
+{
+  double energy = 0;
+  for (DeviceEnergyModelContainer::Iterator i = models.Begin (); i != models.End (); ++i)
+    {
+      Ptr<GatewayEnergyModel> model = DynamicCast<GatewayEnergyModel> (*i);
+      if (model != 0)
+        {
+          energy += model->GetTotalEnergyConsumption ();
+        }
+    }
+  return energy;
+}
+
+void
+GatewayEnergyModelHelper::PrintEnergy (DeviceEnergyModelContainer models, std::string filename)
+{
+  std::ofstream out (filename.c_str ());
+  NS_ABORT_MSG_IF (!out.is_open (), "Cannot open " << filename);
+
+  out << "gateway,energyJ,averagePowerW,receptions,rxTimeS,txTimeS" << std::endl;
+  uint32_t gateway = 0;
+  for (DeviceEnergyModelContainer::Iterator i = models.Begin (); i != models.End (); ++i)
+    {
+      Ptr<GatewayEnergyModel> model = DynamicCast<GatewayEnergyModel> (*i);
+      if (model == 0)
+        {
+          continue;
+        }
+      out << gateway << "," << model->GetTotalEnergyConsumption () << ","
+          << model->GetAveragePowerW () << "," << model->GetReceptionCount () << ","
+          << model->GetReceptionTime ().GetSeconds () << ","
+          << model->GetTransmissionTime ().GetSeconds () << std::endl;
+      gateway++;
+    }
+}
+
+void
+GatewayEnergyModelHelper::EnableEnergyDump (DeviceEnergyModelContainer models,
+                                            std::string filename)
+{
+  Simulator::ScheduleDestroy (&GatewayEnergyModelHelper::PrintEnergy, models, filename);
+}
+
+} // namespace sigfox
+} // namespace ns3
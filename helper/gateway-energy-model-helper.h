@@ -0,0 +1,101 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef GATEWAY_ENERGY_MODEL_HELPER_H
+#define GATEWAY_ENERGY_MODEL_HELPER_H
+
+#include "ns3/gateway-energy-model.h"
+#include "ns3/device-energy-model-container.h"
+#include "ns3/net-device-container.h"
+#include "ns3/object-factory.h"
+#include <string>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * \ingroup energy
+ * \brief Install a GatewayEnergyModel on gateways.
+ *
+ * Unlike the helpers of end point models, no energy source is needed. The
+ * models are not aggregated to the node, which may hold several gateway
+ * devices: keep the container Install returns to query them.
+ */
+class GatewayEnergyModelHelper
+{
+public:
+  GatewayEnergyModelHelper ();
+
+  ~GatewayEnergyModelHelper ();
+
+  /**
+   * \param name the name of the attribute to set
+   * \param v the value of the attribute
+   *
+   * Sets an attribute of the underlying GatewayEnergyModel.
+   */
+  void Set (std::string name, const AttributeValue &v);
+
+  /**
+   * \param device A SigfoxNetDevice with a GatewaySigfoxPhy.
+   * \returns The model installed on the device.
+   */
+  Ptr<GatewayEnergyModel> Install (Ptr<NetDevice> device) const;
+
+  /**
+   * \param devices SigfoxNetDevices with a GatewaySigfoxPhy.
+   * \returns The models installed on the devices.
+   */
+  DeviceEnergyModelContainer Install (NetDeviceContainer devices) const;
+
+  /**
+   * \param models The energy models to sum, GatewayEnergyModel ones are
+   * considered.
+   * \returns The energy consumed by all gateways so far, in Joules.
+   */
+  static double GetTotalEnergyConsumption (DeviceEnergyModelContainer models);
+
+  /**
+   * Write the consumption of some gateways since their models were
+   * installed, one line per GatewayEnergyModel in the order of the
+   * container:
+   *
+   *   gateway,energyJ,averagePowerW,receptions,rxTimeS,txTimeS
+   *
+   * \param models The energy models.
+   * \param filename The file to write to.
+   */
+  static void PrintEnergy (DeviceEnergyModelContainer models, std::string filename);
+
+  /**
+   * Write the consumption of some gateways when the simulation is destroyed,
+   * as PrintEnergy does.
+   *
+   * \param models The energy models.
+   * \param filename The file to write to.
+   */
+  static void EnableEnergyDump (DeviceEnergyModelContainer models, std::string filename);
+
+private:
+  ObjectFactory m_gatewayEnergy; //!< The factory of the models
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* GATEWAY_ENERGY_MODEL_HELPER_H */
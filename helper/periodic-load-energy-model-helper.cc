@@ -0,0 +1,51 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/periodic-load-energy-model-helper.h"
+
+namespace ns3 {
+namespace sigfox {
+
+PeriodicLoadEnergyModelHelper::PeriodicLoadEnergyModelHelper ()
+{
+  m_load.SetTypeId ("ns3::PeriodicLoadEnergyModel");
+}
+
+PeriodicLoadEnergyModelHelper::~PeriodicLoadEnergyModelHelper ()
+{
+}
+
+void
+PeriodicLoadEnergyModelHelper::Set (std::string name, const AttributeValue &v)
+{
+  m_load.Set (name, v);
+}
+
+Ptr<DeviceEnergyModel>
+PeriodicLoadEnergyModelHelper::DoInstall (Ptr<NetDevice> device, Ptr<EnergySource> source) const
+{
+  NS_ASSERT (source != 0);
+
+  Ptr<PeriodicLoadEnergyModel> model = m_load.Create<PeriodicLoadEnergyModel> ();
+  model->SetEnergySource (source);
+  source->AppendDeviceEnergyModel (model);
+  return model;
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,64 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef PERIODIC_LOAD_ENERGY_MODEL_HELPER_H
+#define PERIODIC_LOAD_ENERGY_MODEL_HELPER_H
+
+#include "ns3/energy-model-helper.h"
+#include "ns3/periodic-load-energy-model.h"
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * \ingroup energy
+ * \brief Assign a PeriodicLoadEnergyModel to the nodes of some devices.
+ */
+class PeriodicLoadEnergyModelHelper : public DeviceEnergyModelHelper
+{
+public:
+  PeriodicLoadEnergyModelHelper ();
+
+  ~PeriodicLoadEnergyModelHelper ();
+
+  /**
+   * \param name the name of the attribute to set
+   * \param v the value of the attribute
+   *
+   * Sets an attribute of the underlying PeriodicLoadEnergyModel.
+   */
+  void Set (std::string name, const AttributeValue &v);
+
+private:
+  /**
+   * \param device Pointer to the NetDevice of the node.
+   * \param source Pointer to EnergySource to draw from.
+   * \returns Ptr<DeviceEnergyModel>
+   *
+   * Implements DeviceEnergyModel::Install.
+   */
+  virtual Ptr<DeviceEnergyModel> DoInstall (Ptr<NetDevice> device,
+                                            Ptr<EnergySource> source) const;
+
+  ObjectFactory m_load; //!< The factory of the models
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* PERIODIC_LOAD_ENERGY_MODEL_HELPER_H */
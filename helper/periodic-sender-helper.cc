@@ -42,15 +42,10 @@ PeriodicSenderHelper::PeriodicSenderHelper ()
   // m_factory.Set ("PacketSizeRandomVariable", StringValue
   //                  ("ns3::ParetoRandomVariable[Bound=10|Shape=2.5]"));
 
-  m_initialDelay = CreateObject<UniformRandomVariable> ();
-  m_initialDelay->SetAttribute ("Min", DoubleValue (0));
-
-  m_intervalProb = CreateObject<UniformRandomVariable> ();
-  m_intervalProb->SetAttribute ("Min", DoubleValue (0));
-  m_intervalProb->SetAttribute ("Max", DoubleValue (1));
-
   m_pktSize = 10;
   m_pktSizeRV = 0;
+
+  m_weather = CreateObject<WeatherProcess> ();
 }
 
 PeriodicSenderHelper::~PeriodicSenderHelper ()
@@ -91,46 +86,26 @@ PeriodicSenderHelper::InstallPriv (Ptr<Node> node) const
 
   Ptr<PeriodicSender> app = m_factory.Create<PeriodicSender> ();
 
-  Time interval;
-  if (m_period == Seconds (0))
-    {
-      double intervalProb = m_intervalProb->GetValue ();
-      NS_LOG_DEBUG ("IntervalProb = " << intervalProb);
-
-      // Based on TR 45.820
-      if (intervalProb < 0.4)
-        {
-          interval = Days (1);
-        }
-      else if (0.4 <= intervalProb  && intervalProb < 0.8)
-        {
-          interval = Hours (2);
-        }
-      else if (0.8 <= intervalProb  && intervalProb < 0.95)
-        {
-          interval = Hours (1);
-        }
-      else
-        {
-          interval = Minutes (30);
-        }
-    }
-  else
-    {
-      interval = m_period;
-    }
-
-  app->SetInterval (interval);
+  // A zero period has the application draw its interval when it starts
+  app->SetInterval (m_period);
   NS_LOG_DEBUG ("Created an application with interval = " <<
-                interval.GetHours () << " hours");
+                m_period.GetHours () << " hours");
 
-  app->SetInitialDelay (Seconds (m_initialDelay->GetValue (0, interval.GetSeconds ())));
+  app->SetRandomInitialDelay (true);
   app->SetPacketSize (m_pktSize);
+  if (m_sensorTracePhaseRV)
+    {
+      app->SetSensorTracePhase (m_sensorTracePhaseRV->GetInteger ());
+    }
+  app->SetWeatherProcess (m_weather);
+  app->SetFleetTrafficGenerator (m_fleet);
   app->SelectTransmissionStrategy (EnableTransmissionStrategy);
     app->SelectBiDirectionalProcedureFrequency(EnableBiDirectionalProcedure);
   if (m_pktSizeRV)
     {
-      app->SetPacketSizeRandomVariable (m_pktSizeRV);
+      // Each application draws from its own copy, so that it can be given
+      // its own stream
+      app->SetPacketSizeRandomVariable (CopyRandomVariable (m_pktSizeRV));
     }
 
   app->SetNode (node);
@@ -158,6 +133,24 @@ PeriodicSenderHelper::SetPacketSize (uint8_t size)
   m_pktSize = size;
 }
 
+void
+PeriodicSenderHelper::SetWeatherProcess (Ptr<WeatherProcess> weather)
+{
+  m_weather = weather;
+}
+
+void
+PeriodicSenderHelper::SetFleetTrafficGenerator (Ptr<FleetTrafficGenerator> fleet)
+{
+  m_fleet = fleet;
+}
+
+void
+PeriodicSenderHelper::SetSensorTracePhaseRandomVariable (Ptr<RandomVariableStream> rv)
+{
+  m_sensorTracePhaseRV = rv;
+}
+
 void PeriodicSenderHelper::SelectTransmissionStrategy (uint8_t  SelectStrategy)
 {
     EnableTransmissionStrategy = SelectStrategy;
@@ -168,5 +161,43 @@ void PeriodicSenderHelper::SelectBDPFrequency(uint8_t BDPF)
     EnableBiDirectionalProcedure = BDPF;
 }
 
+int64_t
+PeriodicSenderHelper::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  return m_weather->AssignStreams (stream);
+}
+
+Ptr<RandomVariableStream>
+PeriodicSenderHelper::CopyRandomVariable (Ptr<RandomVariableStream> rv)
+{
+  ObjectFactory factory;
+  TypeId tid = rv->GetInstanceTypeId ();
+  factory.SetTypeId (tid);
+
+  // Copy every attribute, those of the parent classes included
+  while (true)
+    {
+      for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
+        {
+          struct TypeId::AttributeInformation info = tid.GetAttribute (i);
+          if ((info.flags & TypeId::ATTR_GET) && (info.flags & TypeId::ATTR_SET))
+            {
+              Ptr<AttributeValue> value = info.checker->Create ();
+              rv->GetAttribute (info.name, *value);
+              factory.Set (info.name, *value);
+            }
+        }
+      if (tid.GetParent () == tid)
+        {
+          break;
+        }
+      tid = tid.GetParent ();
+    }
+
+  return factory.Create<RandomVariableStream> ();
+}
+
 }
 } // namespace ns3
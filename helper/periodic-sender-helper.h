@@ -57,35 +57,88 @@ public:
   /**
    * Set the period to be used by the applications created by this helper.
    *
-   * A value of Seconds (0) results in randomly generated periods according to
-   * the model contained in the TR 45.820 document.
+   * A value of Seconds (0) has each application draw its period when it
+   * starts, according to the model contained in the TR 45.820 document.
    *
    * \param period The period to set
    */
   void SetPeriod (Time period);
 
+  /**
+   * \param rv The random variable whose value is added to the packet size
+   * of each message. Every application draws from its own copy of it.
+   */
   void SetPacketSizeRandomVariable (Ptr <RandomVariableStream> rv);
 
   void SetPacketSize (uint8_t size);
+
+  /**
+   * Set the random variable that draws the first measurement of the sensor
+   * trace read by each application. Without it, all applications start from
+   * the first measurement.
+   *
+   * \param rv The random variable, returning an index in the trace.
+   */
+  void SetSensorTracePhaseRandomVariable (Ptr<RandomVariableStream> rv);
+
+  /**
+   * Set the weather seen by the Weather Driven Strategy of the applications
+   * created by this helper. By default, all the applications of a helper
+   * share a WeatherProcess with default attributes.
+   *
+   * \param weather The weather process.
+   */
+  void SetWeatherProcess (Ptr<WeatherProcess> weather);
+
+  /**
+   * Have a FleetTrafficGenerator schedule the messages of the applications
+   * created by this helper, so that they do not keep one pending event each.
+   *
+   * \param fleet The generator, or 0 to let applications schedule their own
+   * events.
+   */
+  void SetFleetTrafficGenerator (Ptr<FleetTrafficGenerator> fleet);
     
   void SelectTransmissionStrategy (uint8_t  SelectStrategy);
 
     void SelectBDPFrequency(uint8_t BDPF);
+
+  /**
+   * Assign a fixed random variable stream number to the weather process
+   * shared by the applications of this helper, see
+   * WeatherProcess::AssignStreams.
+   *
+   * The applications themselves get their streams from
+   * SigfoxHelper::AssignStreams, see PeriodicSender::AssignStreams.
+   *
+   * \param stream The first stream index to use.
+   * \return The number of stream indices assigned.
+   */
+  int64_t AssignStreams (int64_t stream);
 private:
+  /**
+   * \param rv A random variable.
+   * \return A new random variable of the same type and with the same
+   * attributes.
+   */
+  static Ptr<RandomVariableStream> CopyRandomVariable (Ptr<RandomVariableStream> rv);
+
   Ptr<Application> InstallPriv (Ptr<Node> node) const;
 
   ObjectFactory m_factory;
 
-  Ptr<UniformRandomVariable> m_initialDelay;
-
-  Ptr<UniformRandomVariable> m_intervalProb;
-
   Time m_period; //!< The period with which the application will be set to send
                  // messages
 
   Ptr<RandomVariableStream> m_pktSizeRV; // whether or not a random component is added to the packet size
 
   uint8_t m_pktSize; // the packet size.
+
+  Ptr<RandomVariableStream> m_sensorTracePhaseRV; //!< The first measurement of each application
+
+  Ptr<WeatherProcess> m_weather; //!< The weather of the applications
+
+  Ptr<FleetTrafficGenerator> m_fleet; //!< The generator of the applications, if any
     
     uint8_t EnableTransmissionStrategy = 0;
     uint8_t EnableBiDirectionalProcedure = 0;
@@ -23,8 +23,11 @@
 
 #include "ns3/sigfox-helper.h"
 #include "ns3/log.h"
+#include "ns3/periodic-sender.h"
+#include "ns3/abort.h"
 
 #include <fstream>
+#include <algorithm>
 
 namespace ns3 {
 namespace sigfox {
@@ -78,6 +81,45 @@ NS_LOG_COMPONENT_DEFINE ("SigfoxHelper");
   return devices;
 }
 
+int64_t
+SigfoxHelper::AssignStreams (NodeContainer c, int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  int64_t reserved = 0;
+  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
+    {
+      Ptr<Node> node = *i;
+      int64_t nodeStream = stream + streamsPerNode * node->GetId ();
+      int64_t used = 0;
+
+      for (uint32_t d = 0; d < node->GetNDevices (); d++)
+        {
+          Ptr<SigfoxNetDevice> device = DynamicCast<SigfoxNetDevice> (node->GetDevice (d));
+          if (device)
+            {
+              used += device->GetMac ()->AssignStreams (nodeStream + used);
+            }
+        }
+
+      for (uint32_t a = 0; a < node->GetNApplications (); a++)
+        {
+          Ptr<PeriodicSender> app = DynamicCast<PeriodicSender> (node->GetApplication (a));
+          if (app)
+            {
+              used += app->AssignStreams (nodeStream + used);
+            }
+        }
+
+      NS_ABORT_MSG_IF (used > streamsPerNode,
+                       "Node " << node->GetId () << " needs " << used << " streams");
+
+      reserved = std::max (reserved, streamsPerNode * (node->GetId () + 1));
+    }
+
+  return reserved;
+}
+
 NetDeviceContainer
 SigfoxHelper::Install ( const SigfoxPhyHelper &phy,
                       const SigfoxMacHelper &mac,
@@ -113,6 +113,26 @@ public:
   void DoPrintDeviceStatus (NodeContainer endDevices, NodeContainer gateways,
                             std::string filename);
 
+  /**
+   * Assign a fixed random variable stream number to the random variables used
+   * by the Sigfox devices and the PeriodicSender applications installed on a
+   * set of nodes.
+   *
+   * Each node gets a block of streamsPerNode streams, starting at
+   * stream + streamsPerNode * node id, so that the streams a device uses do
+   * not depend on the other nodes in the container or on the order in which
+   * they were installed. Call it once the devices and the applications are
+   * installed, before the simulation starts.
+   *
+   * \param c The nodes.
+   * \param stream The first stream index to use.
+   * \return The number of stream indices reserved, i.e., streamsPerNode
+   * times the largest node id in c plus one.
+   */
+  int64_t AssignStreams (NodeContainer c, int64_t stream);
+
+  static const int64_t streamsPerNode = 8; //!< Streams reserved for each node
+
 private:
   /**
    * Actually print the simulation time and re-schedule execution of this
@@ -35,6 +35,19 @@ NS_LOG_COMPONENT_DEFINE ("SigfoxMacHelper");
 
 SigfoxMacHelper::SigfoxMacHelper () : m_region (SigfoxMacHelper::EU)
 {
+  CreateChannelPlan ();
+}
+
+void
+SigfoxMacHelper::SetFrequencyHoppingSequence (Ptr<FrequencyHoppingSequence> sequence)
+{
+  m_hoppingSequence = sequence;
+}
+
+void
+SigfoxMacHelper::SetDownlinkScheduler (Ptr<DownlinkScheduler> scheduler)
+{
+  m_downlinkScheduler = scheduler;
 }
 
 void
@@ -63,6 +76,30 @@ void
 SigfoxMacHelper::SetRegion (enum SigfoxMacHelper::Regions region)
 {
   m_region = region;
+  CreateChannelPlan ();
+}
+
+void
+SigfoxMacHelper::CreateChannelPlan (void)
+{
+  // Regions are numbered like radio configurations
+  enum SigfoxRadioConfiguration rc = static_cast<enum SigfoxRadioConfiguration> (m_region);
+  const SigfoxRadioConfigurationParameters &params = GetRadioConfigurationParameters (rc);
+
+  double firstFrequency = params.uplinkCenterFrequencyHz - params.macroChannelWidthHz / 2;
+  double lastFrequency = params.uplinkCenterFrequencyHz + params.macroChannelWidthHz / 2;
+
+  // Devices that were already created keep using the previous plan
+  m_channelPlan = ns3::Create<SigfoxChannelPlan> ();
+  m_channelPlan->SetRadioConfiguration (rc);
+  m_channelPlan->AddSubBand (firstFrequency, lastFrequency, params.dutyCycle,
+                             params.maxEirpDbm);
+  m_channelPlan->SetFrequencyRange (firstFrequency, lastFrequency);
+
+  // Downlinks from the gateways
+  m_channelPlan->AddSubBand (params.downlinkCenterFrequencyHz - downlinkSubBandWidthHz / 2,
+                             params.downlinkCenterFrequencyHz + downlinkSubBandWidthHz / 2,
+                             params.downlinkDutyCycle, params.downlinkMaxEirpDbm);
 }
 
 Ptr<SigfoxMac>
@@ -71,12 +108,19 @@ SigfoxMacHelper::Create (Ptr<Node> node, Ptr<NetDevice> device) const
   Ptr<SigfoxMac> mac = m_mac.Create<SigfoxMac> ();
   mac->SetDevice (device);
 
-  LogicalSigfoxChannelHelper channelHelper;
-  channelHelper.AddSubBand (868, 868.6, 0.01, 14);
-  // double margins = 1.406e3 + 17.363e3;
-  // channelHelper.SetFrequencyRange (868.034e6 + margins, 868.226e6 - margins);
-  channelHelper.SetFrequencyRange (868.034e6, 868.034e6 + 192e3);
-  mac->SetLogicalSigfoxChannelHelper (channelHelper);
+  mac->GetLogicalSigfoxChannelHelper ()->SetChannelPlan (m_channelPlan);
+
+  Ptr<EndPointSigfoxMac> endPointMac = mac->GetObject<EndPointSigfoxMac> ();
+  if (endPointMac && m_hoppingSequence)
+    {
+      endPointMac->SetFrequencyHoppingSequence (m_hoppingSequence);
+    }
+
+  Ptr<GatewaySigfoxMac> gatewayMac = mac->GetObject<GatewaySigfoxMac> ();
+  if (gatewayMac && m_downlinkScheduler)
+    {
+      m_downlinkScheduler->AddGateway (gatewayMac);
+    }
 
   return mac;
 }
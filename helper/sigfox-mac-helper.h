@@ -30,6 +30,7 @@
 #include "ns3/end-point-sigfox-mac.h"
 #include "ns3/sigfox-mac.h"
 #include "ns3/gateway-sigfox-mac.h"
+#include "ns3/downlink-scheduler.h"
 #include "ns3/node-container.h"
 #include "ns3/random-variable-stream.h"
 
@@ -45,9 +46,10 @@ public:
   enum DeviceType { GW, EP };
 
   /**
-   * Define the operational region.
+   * Define the operational region, as a Sigfox radio configuration. EU is an
+   * alias of RC1.
    */
-  enum Regions { EU };
+  enum Regions { RC1, RC2, RC3, RC4, RC5, RC6, RC7, EU = RC1 };
 
   /**
    * Create a mac helper without any parameter set. The user must set
@@ -75,6 +77,22 @@ public:
    */
   void SetRegion (enum Regions region);
 
+  /**
+   * Have end point MACs created by this helper choose the frequency of their
+   * repetitions according to a deterministic hopping sequence.
+   *
+   * \param sequence The sequence, shared by all the devices.
+   */
+  void SetFrequencyHoppingSequence (Ptr<FrequencyHoppingSequence> sequence);
+
+  /**
+   * Have gateway MACs created by this helper report their uplinks to a
+   * downlink scheduler, and send the replies it decides.
+   *
+   * \param scheduler The scheduler, shared by all the gateways.
+   */
+  void SetDownlinkScheduler (Ptr<DownlinkScheduler> scheduler);
+
   /**
    * Create the SigfoxMac instance and connect it to a device
    *
@@ -85,9 +103,17 @@ public:
   Ptr<SigfoxMac> Create (Ptr<Node> node, Ptr<NetDevice> device) const;
 
 private:
+  /**
+   * Build the channel plan of the current region.
+   */
+  void CreateChannelPlan (void);
+
   ObjectFactory m_mac;
   enum DeviceType m_deviceType; //!< The kind of device to install
   enum Regions m_region; //!< The region in which the device will operate
+  Ptr<FrequencyHoppingSequence> m_hoppingSequence; //!< The sequence end points hop with
+  Ptr<DownlinkScheduler> m_downlinkScheduler; //!< The scheduler gateways report to
+  Ptr<SigfoxChannelPlan> m_channelPlan; //!< The plan shared by all created MACs
 };
 
 } // namespace sigfox
@@ -22,11 +22,17 @@
 #include "ns3/sigfox-net-device.h"
 #include "ns3/sigfox-tx-current-model.h"
 #include "ns3/end-point-sigfox-phy.h"
+#include "ns3/end-point-sigfox-mac.h"
+#include "ns3/periodic-sender.h"
+#include "ns3/simulator.h"
+#include "ns3/abort.h"
+#include <fstream>
 
 namespace ns3 {
 namespace sigfox {
 
 SigfoxRadioEnergyModelHelper::SigfoxRadioEnergyModelHelper ()
+  : m_suspendOnDepletion (false)
 {
   m_radioEnergy.SetTypeId ("ns3::SigfoxRadioEnergyModel");
 }
@@ -65,6 +71,123 @@ SigfoxRadioEnergyModelHelper::SetTxCurrentModel (std::string name,
   m_txCurrentModel = factory;
 }
 
+void
+SigfoxRadioEnergyModelHelper::SetSuspendOnDepletion (bool suspend)
+{
+  m_suspendOnDepletion = suspend;
+}
+
+void
+SigfoxRadioEnergyModelHelper::SuspendNode (Ptr<Node> node)
+{
+  for (uint32_t i = 0; i < node->GetNDevices (); i++)
+    {
+      Ptr<SigfoxNetDevice> device = node->GetDevice (i)->GetObject<SigfoxNetDevice> ();
+      if (device != 0 && device->GetMac ()->GetObject<EndPointSigfoxMac> () != 0)
+        {
+          device->GetMac ()->GetObject<EndPointSigfoxMac> ()->Suspend ();
+        }
+    }
+  for (uint32_t i = 0; i < node->GetNApplications (); i++)
+    {
+      Ptr<PeriodicSender> app = DynamicCast<PeriodicSender> (node->GetApplication (i));
+      if (app != 0)
+        {
+          app->Suspend ();
+        }
+    }
+}
+
+void
+SigfoxRadioEnergyModelHelper::ResumeNode (Ptr<Node> node)
+{
+  for (uint32_t i = 0; i < node->GetNDevices (); i++)
+    {
+      Ptr<SigfoxNetDevice> device = node->GetDevice (i)->GetObject<SigfoxNetDevice> ();
+      if (device != 0 && device->GetMac ()->GetObject<EndPointSigfoxMac> () != 0)
+        {
+          device->GetMac ()->GetObject<EndPointSigfoxMac> ()->Resume ();
+        }
+    }
+  for (uint32_t i = 0; i < node->GetNApplications (); i++)
+    {
+      Ptr<PeriodicSender> app = DynamicCast<PeriodicSender> (node->GetApplication (i));
+      if (app != 0)
+        {
+          app->Resume ();
+        }
+    }
+}
+
+double
+SigfoxRadioEnergyModelHelper::GetStateEnergyConsumption (DeviceEnergyModelContainer models,
+                                                         EndPointSigfoxPhy::State state)
+{
+  double energy = 0;
+  for (DeviceEnergyModelContainer::Iterator i = models.Begin (); i != models.End (); ++i)
+    {
+      Ptr<SigfoxRadioEnergyModel> model = DynamicCast<SigfoxRadioEnergyModel> (*i);
+      if (model != 0)
+        {
+          energy += model->GetStateEnergyConsumption (state);
+        }
+    }
+  return energy;
+}
+
+Time
+SigfoxRadioEnergyModelHelper::GetStateTime (DeviceEnergyModelContainer models,
+                                            EndPointSigfoxPhy::State state)
+{
+  Time time = Seconds (0);
+  for (DeviceEnergyModelContainer::Iterator i = models.Begin (); i != models.End (); ++i)
+    {
+      Ptr<SigfoxRadioEnergyModel> model = DynamicCast<SigfoxRadioEnergyModel> (*i);
+      if (model != 0)
+        {
+          time += model->GetStateTime (state);
+        }
+    }
+  return time;
+}
+
+void
+SigfoxRadioEnergyModelHelper::PrintStateCounters (DeviceEnergyModelContainer models,
+                                                  std::string filename)
+{
+  std::ofstream out (filename.c_str ());
+  NS_ABORT_MSG_IF (!out.is_open (), "Cannot open " << filename);
+
+  static const EndPointSigfoxPhy::State states[] = {EndPointSigfoxPhy::TX, EndPointSigfoxPhy::RX,
+                                                     EndPointSigfoxPhy::STANDBY,
+                                                     EndPointSigfoxPhy::SLEEP};
+  static const char *names[] = {"TX", "RX", "STANDBY", "SLEEP"};
+
+  out << "device,state,timeS,energy,transitions" << std::endl;
+  uint32_t device = 0;
+  for (DeviceEnergyModelContainer::Iterator i = models.Begin (); i != models.End (); ++i)
+    {
+      Ptr<SigfoxRadioEnergyModel> model = DynamicCast<SigfoxRadioEnergyModel> (*i);
+      if (model == 0)
+        {
+          continue;
+        }
+      for (uint32_t s = 0; s < 4; s++)
+        {
+          out << device << "," << names[s] << "," << model->GetStateTime (states[s]).GetSeconds ()
+              << "," << model->GetStateEnergyConsumption (states[s]) << ","
+              << model->GetStateTransitions (states[s]) << std::endl;
+        }
+      device++;
+    }
+}
+
+void
+SigfoxRadioEnergyModelHelper::EnableStateCountersDump (DeviceEnergyModelContainer models,
+                                                       std::string filename)
+{
+  Simulator::ScheduleDestroy (&SigfoxRadioEnergyModelHelper::PrintStateCounters, models, filename);
+}
 
 /*
  * Private function starts here.
@@ -92,10 +215,20 @@ SigfoxRadioEnergyModelHelper::DoInstall (Ptr<NetDevice> device,
   // if none is specified, make a callback to EndPointSigfoxPhy::SetSleepMode
   Ptr<SigfoxNetDevice> sigfoxDevice = device->GetObject<SigfoxNetDevice> ();
   Ptr<EndPointSigfoxPhy> sigfoxPhy = sigfoxDevice->GetPhy ()->GetObject<EndPointSigfoxPhy> ();
+  if (sigfoxPhy == 0)
+    {
+      NS_FATAL_ERROR ("SigfoxNetDevice is not an end point, use GatewayEnergyModelHelper!");
+    }
   // add model to device model list in energy source
   source->AppendDeviceEnergyModel (model);
-  // create and register energy model phy listener
-  sigfoxPhy->RegisterListener (model->GetPhyListener ());
+  // register the energy model on the PHY's direct notification path
+  sigfoxPhy->RegisterEnergyModel (PeekPointer (model));
+
+  if (m_suspendOnDepletion)
+    {
+      model->SetEnergyDepletionCallback (MakeBoundCallback (&SigfoxRadioEnergyModelHelper::SuspendNode, node));
+      model->SetEnergyRechargedCallback (MakeBoundCallback (&SigfoxRadioEnergyModelHelper::ResumeNode, node));
+    }
 
   if (m_txCurrentModel.GetTypeId ().GetUid ())
     {
@@ -23,6 +23,8 @@
 
 #include "ns3/energy-model-helper.h"
 #include "ns3/sigfox-radio-energy-model.h"
+#include "ns3/node.h"
+#include <string>
 
 namespace ns3 {
 namespace sigfox {
@@ -86,6 +88,66 @@ public:
                           std::string n6 = "", const AttributeValue &v6 = EmptyAttributeValue (),
                           std::string n7 = "", const AttributeValue &v7 = EmptyAttributeValue ());
 
+  /**
+   * \param suspend Whether the installed models suspend the MAC layer and
+   * the PeriodicSender applications of their node when the energy source is
+   * depleted, and resume them when it is recharged. The radio of a
+   * suspended device sleeps, and the device schedules no events until it is
+   * resumed.
+   */
+  void SetSuspendOnDepletion (bool suspend);
+
+  /**
+   * Suspend the EndPointSigfoxMac and PeriodicSender objects of a node.
+   *
+   * \param node The node.
+   */
+  static void SuspendNode (Ptr<Node> node);
+
+  /**
+   * Resume the EndPointSigfoxMac and PeriodicSender objects of a node.
+   *
+   * \param node The node.
+   */
+  static void ResumeNode (Ptr<Node> node);
+
+  /**
+   * \param models The energy models to sum, SigfoxRadioEnergyModel ones are
+   * considered.
+   * \param state A radio state.
+   * \returns The energy consumed by all models in that state so far.
+   */
+  static double GetStateEnergyConsumption (DeviceEnergyModelContainer models,
+                                           EndPointSigfoxPhy::State state);
+
+  /**
+   * \param models The energy models to sum, SigfoxRadioEnergyModel ones are
+   * considered.
+   * \param state A radio state.
+   * \returns The time spent by all models in that state so far.
+   */
+  static Time GetStateTime (DeviceEnergyModelContainer models, EndPointSigfoxPhy::State state);
+
+  /**
+   * Write the per-state counters of some radios, one line per
+   * SigfoxRadioEnergyModel in the order of the container:
+   *
+   *   device,state,timeS,energy,transitions
+   *
+   * \param models The energy models.
+   * \param filename The file to write to.
+   */
+  static void PrintStateCounters (DeviceEnergyModelContainer models, std::string filename);
+
+  /**
+   * Write the per-state counters of some radios when the simulation is
+   * destroyed, as PrintStateCounters does.
+   *
+   * \param models The energy models.
+   * \param filename The file to write to.
+   */
+  static void EnableStateCountersDump (DeviceEnergyModelContainer models, std::string filename);
+
 private:
   /**
    * \param device Pointer to the NetDevice to install DeviceEnergyModel.
@@ -100,6 +162,7 @@ private:
 private:
   ObjectFactory m_radioEnergy; ///< radio energy
   ObjectFactory m_txCurrentModel; ///< transmit current model
+  bool m_suspendOnDepletion; ///< whether devices are suspended on depletion
 
 };
 
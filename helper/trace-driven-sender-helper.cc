@@ -0,0 +1,104 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/trace-driven-sender-helper.h"
+#include "ns3/string.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("TraceDrivenSenderHelper");
+
+TraceDrivenSenderHelper::TraceDrivenSenderHelper (std::string traceFile)
+  : m_firstColumn (0)
+{
+  m_factory.SetTypeId ("ns3::TraceDrivenSender");
+  m_factory.Set ("TraceFile", StringValue (traceFile));
+
+  m_policyFactory.SetTypeId ("ns3::DeadBandSigfoxSendPolicy");
+}
+
+TraceDrivenSenderHelper::~TraceDrivenSenderHelper ()
+{
+}
+
+void
+TraceDrivenSenderHelper::SetAttribute (std::string name, const AttributeValue &value)
+{
+  m_factory.Set (name, value);
+}
+
+void
+TraceDrivenSenderHelper::SetSendPolicy (std::string name,
+                                        std::string n0, const AttributeValue &v0,
+                                        std::string n1, const AttributeValue &v1,
+                                        std::string n2, const AttributeValue &v2,
+                                        std::string n3, const AttributeValue &v3)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (name);
+  factory.Set (n0, v0);
+  factory.Set (n1, v1);
+  factory.Set (n2, v2);
+  factory.Set (n3, v3);
+  m_policyFactory = factory;
+}
+
+void
+TraceDrivenSenderHelper::SetFirstColumn (uint32_t column)
+{
+  m_firstColumn = column;
+}
+
+ApplicationContainer
+TraceDrivenSenderHelper::Install (Ptr<Node> node) const
+{
+  return ApplicationContainer (InstallPriv (node, m_firstColumn));
+}
+
+ApplicationContainer
+TraceDrivenSenderHelper::Install (NodeContainer c) const
+{
+  ApplicationContainer apps;
+  uint32_t column = m_firstColumn;
+  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
+    {
+      apps.Add (InstallPriv (*i, column++));
+    }
+
+  return apps;
+}
+
+Ptr<Application>
+TraceDrivenSenderHelper::InstallPriv (Ptr<Node> node, uint32_t column) const
+{
+  NS_LOG_FUNCTION (this << node << column);
+
+  Ptr<TraceDrivenSender> app = m_factory.Create<TraceDrivenSender> ();
+  app->SetColumn (column);
+  app->SetSendPolicy (m_policyFactory.Create<SigfoxSendPolicy> ());
+
+  app->SetNode (node);
+  node->AddApplication (app);
+
+  return app;
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef TRACE_DRIVEN_SENDER_HELPER_H
+#define TRACE_DRIVEN_SENDER_HELPER_H
+
+#include "ns3/object-factory.h"
+#include "ns3/attribute.h"
+#include "ns3/node-container.h"
+#include "ns3/application-container.h"
+#include "ns3/trace-driven-sender.h"
+#include <stdint.h>
+#include <string>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * This class can be used to install TraceDrivenSender applications that
+ * replay the columns of a trace file, one per node.
+ */
+class TraceDrivenSenderHelper
+{
+public:
+  /**
+   * \param traceFile The columnar trace file to replay.
+   */
+  TraceDrivenSenderHelper (std::string traceFile);
+
+  ~TraceDrivenSenderHelper ();
+
+  void SetAttribute (std::string name, const AttributeValue &value);
+
+  /**
+   * \param name the name of the policy to set
+   * \param n0 the name of the attribute to set
+   * \param v0 the value of the attribute to set
+   * \param n1 the name of the attribute to set
+   * \param v1 the value of the attribute to set
+   * \param n2 the name of the attribute to set
+   * \param v2 the value of the attribute to set
+   * \param n3 the name of the attribute to set
+   * \param v3 the value of the attribute to set
+   *
+   * Configure the SigfoxSendPolicy of the applications. Each application
+   * gets its own instance.
+   */
+  void SetSendPolicy (std::string name,
+                      std::string n0 = "", const AttributeValue &v0 = EmptyAttributeValue (),
+                      std::string n1 = "", const AttributeValue &v1 = EmptyAttributeValue (),
+                      std::string n2 = "", const AttributeValue &v2 = EmptyAttributeValue (),
+                      std::string n3 = "", const AttributeValue &v3 = EmptyAttributeValue ());
+
+  /**
+   * Set the column replayed by the first node of the containers passed to
+   * Install. The following nodes replay the following columns.
+   *
+   * \param column The first column.
+   */
+  void SetFirstColumn (uint32_t column);
+
+  ApplicationContainer Install (NodeContainer c) const;
+
+  ApplicationContainer Install (Ptr<Node> node) const;
+
+private:
+  Ptr<Application> InstallPriv (Ptr<Node> node, uint32_t column) const;
+
+  ObjectFactory m_factory;       //!< The applications
+  ObjectFactory m_policyFactory; //!< The policies
+  uint32_t m_firstColumn;        //!< The column of the first node
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* TRACE_DRIVEN_SENDER_HELPER_H */
@@ -0,0 +1,394 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/battery-lifetime-estimator.h"
+#include "ns3/sigfox-radio-energy-model.h"
+#include "ns3/simulator.h"
+#include "ns3/node.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+#include "ns3/string.h"
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("BatteryLifetimeEstimator");
+
+NS_OBJECT_ENSURE_REGISTERED (BatteryLifetimeEstimator);
+
+TypeId
+BatteryLifetimeEstimator::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::BatteryLifetimeEstimator")
+    .SetParent<Object> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<BatteryLifetimeEstimator> ()
+    .AddAttribute ("WarmUp",
+                   "The time before measurements start",
+                   TimeValue (Days (1)),
+                   MakeTimeAccessor (&BatteryLifetimeEstimator::m_warmUp),
+                   MakeTimeChecker ())
+    .AddAttribute ("CycleDuration",
+                   "The duration over which the charge drawn is measured, "
+                   "typically a multiple of the traffic period",
+                   TimeValue (Days (1)),
+                   MakeTimeAccessor (&BatteryLifetimeEstimator::m_cycleDuration),
+                   MakeTimeChecker (NanoSeconds (1)))
+    .AddAttribute ("MinCycles",
+                   "The number of consecutive cycles that must agree for a "
+                   "device to be in steady state",
+                   UintegerValue (3),
+                   MakeUintegerAccessor (&BatteryLifetimeEstimator::m_minCycles),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("MaxCycles",
+                   "The number of cycles after which devices that are not in "
+                   "steady state are extrapolated anyway",
+                   UintegerValue (30),
+                   MakeUintegerAccessor (&BatteryLifetimeEstimator::m_maxCycles),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("Tolerance",
+                   "The largest relative difference between the charge of a "
+                   "cycle and the average of the last cycles in steady state",
+                   DoubleValue (0.01),
+                   MakeDoubleAccessor (&BatteryLifetimeEstimator::m_tolerance),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("ValidationFraction",
+                   "The fraction of devices that keep running until their "
+                   "battery is depleted, to validate the estimates",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&BatteryLifetimeEstimator::m_validationFraction),
+                   MakeDoubleChecker<double> (0, 1))
+    .AddAttribute ("OutputFile",
+                   "The file the results are written to",
+                   StringValue ("battery-lifetime.csv"),
+                   MakeStringAccessor (&BatteryLifetimeEstimator::m_outputFile),
+                   MakeStringChecker ())
+    .AddAttribute ("StopWhenDone",
+                   "Whether the simulation is stopped once all devices are done",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&BatteryLifetimeEstimator::m_stopWhenDone),
+                   MakeBooleanChecker ())
+  ;
+  return tid;
+}
+
+BatteryLifetimeEstimator::BatteryLifetimeEstimator ()
+  : m_written (false),
+    m_started (false)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_validationRV = CreateObject<UniformRandomVariable> ();
+  // Keep the estimator alive until the end of the simulation
+  Simulator::ScheduleDestroy (&BatteryLifetimeEstimator::WriteOutputFile,
+                              Ptr<BatteryLifetimeEstimator> (this));
+}
+
+BatteryLifetimeEstimator::~BatteryLifetimeEstimator ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+BatteryLifetimeEstimator::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  WriteOutputFile ();
+  m_cycleEvent.Cancel ();
+  for (std::vector<Device>::iterator d = m_devices.begin (); d != m_devices.end (); d++)
+    {
+      if (d->validation)
+        {
+          d->source->TraceDisconnectWithoutContext ("SdcRemainingEnergy", d->sink);
+        }
+    }
+  m_devices.clear ();
+  Object::DoDispose ();
+}
+
+int64_t
+BatteryLifetimeEstimator::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  m_validationRV->SetStream (stream);
+  return 1;
+}
+
+void
+BatteryLifetimeEstimator::AddDevice (Ptr<SdcEnergySource> source,
+                                     DeviceEnergyModelContainer models)
+{
+  NS_LOG_FUNCTION (this << source);
+
+  NS_ABORT_MSG_IF (m_started, "Devices must be added before the end of the warm up");
+
+  Device device;
+  device.source = source;
+  device.models = models;
+  device.nodeId = source->GetNode () != 0 ? source->GetNode ()->GetId () : m_devices.size ();
+  device.lastCharge = 0;
+  device.cycleCharge.resize (m_minCycles, 0);
+  device.nCycles = 0;
+  device.done = false;
+  device.steady = false;
+  device.meanCurrentA = 0;
+  device.estimate = Time::Max ();
+  device.validation = m_validationRV->GetValue () < m_validationFraction;
+  device.measured = Time::Max ();
+
+  DoubleValue lowThreshold;
+  source->GetAttribute ("SdcEnergyLowBatteryThreshold", lowThreshold);
+  device.lowThresholdJ = lowThreshold.Get () * source->GetInitialEnergy ();
+
+  if (device.validation)
+    {
+      device.sink = MakeBoundCallback (&BatteryLifetimeEstimator::RemainingEnergyChanged, this,
+                                       static_cast<uint32_t> (m_devices.size ()));
+      source->TraceConnectWithoutContext ("SdcRemainingEnergy", device.sink);
+    }
+
+  m_devices.push_back (device);
+
+  if (!m_cycleEvent.IsRunning ())
+    {
+      Time delay = std::max (m_warmUp - Simulator::Now (), Seconds (0));
+      m_cycleEvent = Simulator::Schedule (delay, &BatteryLifetimeEstimator::EndCycle, this);
+    }
+}
+
+void
+BatteryLifetimeEstimator::AddDevice (Ptr<SdcEnergySource> source)
+{
+  AddDevice (source, DeviceEnergyModelContainer ());
+}
+
+void
+BatteryLifetimeEstimator::AddDevices (EnergySourceContainer sources)
+{
+  for (EnergySourceContainer::Iterator i = sources.Begin (); i != sources.End (); ++i)
+    {
+      Ptr<SdcEnergySource> source = DynamicCast<SdcEnergySource> (*i);
+      NS_ABORT_MSG_IF (source == 0, "Only SdcEnergySource lifetimes can be estimated");
+      AddDevice (source);
+    }
+}
+
+double
+BatteryLifetimeEstimator::GetCharge (const Device &device) const
+{
+  if (device.models.GetN () == 0)
+    {
+      return device.source->GetTotalDrainedCharge ();
+    }
+
+  double charge = 0;
+  for (DeviceEnergyModelContainer::Iterator m = device.models.Begin ();
+       m != device.models.End (); ++m)
+    {
+      // Include the state the radio is in, that may span several cycles.
+      // The radio counts charge, the other models count Joules.
+      Ptr<SigfoxRadioEnergyModel> radio = DynamicCast<SigfoxRadioEnergyModel> (*m);
+      charge += radio != 0 ? radio->GetTotalEnergyConsumptionUntilNow ()
+                           : (*m)->GetTotalEnergyConsumption () / device.source->GetSupplyVoltage ();
+    }
+  return charge;
+}
+
+void
+BatteryLifetimeEstimator::EndCycle (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  bool first = !m_started;
+  m_started = true;
+
+  for (uint32_t i = 0; i < m_devices.size (); i++)
+    {
+      Device &device = m_devices[i];
+      if (device.done)
+        {
+          continue;
+        }
+
+      double charge = GetCharge (device);
+      if (first)
+        {
+          device.lastCharge = charge;
+          continue;
+        }
+
+      device.cycleCharge[device.nCycles % m_minCycles] = charge - device.lastCharge;
+      device.lastCharge = charge;
+      device.nCycles++;
+
+      if (device.nCycles < m_minCycles)
+        {
+          continue;
+        }
+
+      double sum = 0;
+      for (uint32_t c = 0; c < m_minCycles; c++)
+        {
+          sum += device.cycleCharge[c];
+        }
+      double mean = sum / m_minCycles;
+
+      double spread = 0;
+      for (uint32_t c = 0; c < m_minCycles; c++)
+        {
+          spread = std::max (spread, std::abs (device.cycleCharge[c] - mean));
+        }
+
+      if (spread <= m_tolerance * mean)
+        {
+          Extrapolate (i, true);
+        }
+      else if (device.nCycles >= m_maxCycles)
+        {
+          Extrapolate (i, false);
+        }
+    }
+
+  CheckDone ();
+
+  bool pending = false;
+  for (uint32_t i = 0; i < m_devices.size () && !pending; i++)
+    {
+      pending = !m_devices[i].done;
+    }
+  if (pending)
+    {
+      m_cycleEvent = Simulator::Schedule (m_cycleDuration, &BatteryLifetimeEstimator::EndCycle, this);
+    }
+}
+
+void
+BatteryLifetimeEstimator::Extrapolate (uint32_t index, bool steady)
+{
+  NS_LOG_FUNCTION (this << index << steady);
+
+  Device &device = m_devices[index];
+
+  double sum = 0;
+  for (uint32_t c = 0; c < m_minCycles; c++)
+    {
+      sum += device.cycleCharge[c];
+    }
+  device.meanCurrentA = sum / m_minCycles / m_cycleDuration.GetSeconds ();
+  device.steady = steady;
+  device.done = true;
+
+  Time remaining = device.source->GetTimeToDepletion (device.meanCurrentA);
+  device.estimate = remaining == Time::Max () ? Time::Max () : Simulator::Now () + remaining;
+
+  NS_LOG_DEBUG ("Node " << device.nodeId << ": " << device.meanCurrentA << " A after " <<
+                device.nCycles << " cycles, depleted at " << device.estimate.GetDays () <<
+                " days" << (steady ? "" : " (not steady)"));
+}
+
+void
+BatteryLifetimeEstimator::RemainingEnergyChanged (BatteryLifetimeEstimator *estimator, uint32_t index,
+                                                  double oldValue, double newValue)
+{
+  if (index >= estimator->m_devices.size ())
+    {
+      return;
+    }
+  Device &device = estimator->m_devices[index];
+  if (device.measured == Time::Max () && newValue <= device.lowThresholdJ)
+    {
+      NS_LOG_DEBUG ("Node " << device.nodeId << " depleted at " << Simulator::Now ().GetDays () <<
+                    " days");
+      device.measured = Simulator::Now ();
+      estimator->CheckDone ();
+    }
+}
+
+void
+BatteryLifetimeEstimator::CheckDone (void)
+{
+  for (std::vector<Device>::const_iterator d = m_devices.begin (); d != m_devices.end (); d++)
+    {
+      if (!d->done || (d->validation && d->measured == Time::Max ()))
+        {
+          return;
+        }
+    }
+
+  NS_LOG_INFO ("All device lifetimes are known");
+  WriteOutputFile ();
+  if (m_stopWhenDone)
+    {
+      Simulator::Stop ();
+    }
+}
+
+void
+BatteryLifetimeEstimator::WriteOutputFile (void)
+{
+  if (m_written || m_devices.empty ())
+    {
+      return;
+    }
+  m_written = true;
+  Write (m_outputFile);
+}
+
+void
+BatteryLifetimeEstimator::Write (std::string filename) const
+{
+  NS_LOG_FUNCTION (this << filename);
+
+  std::ofstream out (filename.c_str ());
+  NS_ABORT_MSG_IF (!out.is_open (), "Cannot open " << filename);
+
+  out << "node,meanCurrentA,cycles,steady,estimatedLifetimeS,measuredLifetimeS" << std::endl;
+  for (std::vector<Device>::const_iterator d = m_devices.begin (); d != m_devices.end (); d++)
+    {
+      out << d->nodeId << "," << d->meanCurrentA << "," << d->nCycles << "," << d->steady << ",";
+      if (d->done && d->estimate != Time::Max ())
+        {
+          out << d->estimate.GetSeconds ();
+        }
+      else
+        {
+          out << -1;
+        }
+      out << ",";
+      if (d->validation && d->measured != Time::Max ())
+        {
+          out << d->measured.GetSeconds ();
+        }
+      else
+        {
+          out << -1;
+        }
+      out << std::endl;
+    }
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,197 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef BATTERY_LIFETIME_ESTIMATOR_H
+#define BATTERY_LIFETIME_ESTIMATOR_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/energy-source-container.h"
+#include "ns3/device-energy-model-container.h"
+#include "ns3/sdc-energy-source.h"
+#include <string>
+#include <vector>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * Estimate how long the battery of each device lasts without simulating
+ * until it is depleted.
+ *
+ * After a WarmUp, the charge drawn from the SdcEnergySource of each device
+ * is measured over consecutive cycles of CycleDuration. Once the charge of the
+ * last MinCycles cycles is the same within Tolerance, the device is in
+ * steady state: its average current is assumed to stay the same, and the
+ * time at which its SdcEnergySource will cross the low battery threshold is
+ * computed analytically, self-discharge included. Devices that are still
+ * not steady after MaxCycles are extrapolated anyway, and flagged.
+ *
+ * Estimated devices are not fast-forwarded: they keep being simulated
+ * like the others, so the time saved comes from StopWhenDone stopping the
+ * simulation once every device is done.
+ *
+ * A ValidationFraction of the devices can be kept running until their
+ * battery is actually depleted, to check the estimates. The results are
+ * written to OutputFile once all devices are done, or when the simulation
+ * is destroyed, one line per device:
+ *
+ *   node,meanCurrentA,cycles,steady,estimatedLifetimeS,measuredLifetimeS
+ *
+ * with a measured lifetime of -1 for devices that were not validated.
+ */
+class BatteryLifetimeEstimator : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  BatteryLifetimeEstimator ();
+  virtual ~BatteryLifetimeEstimator ();
+
+  /**
+   * Estimate the lifetime of a device, as drawn by some of its energy
+   * models only.
+   *
+   * \param source The energy source of the device.
+   * \param models The energy models drawing from the source, or an empty
+   * container for everything drawn from it.
+   */
+  void AddDevice (Ptr<SdcEnergySource> source, DeviceEnergyModelContainer models);
+
+  /**
+   * Estimate the lifetime of a device, as drawn by all the loads of its
+   * source.
+   *
+   * \param source The energy source of the device.
+   */
+  void AddDevice (Ptr<SdcEnergySource> source);
+
+  /**
+   * Estimate the lifetime of some devices, as drawn by all the loads of
+   * their sources.
+   *
+   * \param sources The energy sources of the devices, all SdcEnergySource.
+   */
+  void AddDevices (EnergySourceContainer sources);
+
+  /**
+   * Write the results obtained so far.
+   *
+   * \param filename The file to write to.
+   */
+  void Write (std::string filename) const;
+
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by this estimator.
+   *
+   * \param stream The first stream index to use.
+   * \return The number of stream indices assigned by this estimator.
+   */
+  int64_t AssignStreams (int64_t stream);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * The state of the estimate of a device.
+   */
+  struct Device
+  {
+    Ptr<SdcEnergySource> source;       //!< The energy source
+    DeviceEnergyModelContainer models; //!< The models measured, all if empty
+    uint32_t nodeId;                   //!< The node of the device
+    double lastCharge;                 //!< The charge drawn at the last cycle boundary
+    std::vector<double> cycleCharge;   //!< The charge of the last cycles, circular
+    uint32_t nCycles;                  //!< The number of cycles measured
+    bool done;                         //!< Whether the lifetime was estimated
+    bool steady;                       //!< Whether steady state was reached
+    double meanCurrentA;               //!< The average current in steady state
+    Time estimate;                     //!< The estimated depletion time
+    bool validation;                   //!< Whether the device runs until depletion
+    Time measured;                     //!< The actual depletion time, if known
+    double lowThresholdJ;              //!< The energy at which the source is depleted
+    Callback<void, double, double> sink; //!< Connected to the source, for validation
+  };
+
+  /**
+   * Get the charge drawn by the models of a device so far, in Coulombs.
+   *
+   * \param device The device.
+   */
+  double GetCharge (const Device &device) const;
+
+  /**
+   * Close the current cycle of all devices, and schedule the next one. The
+   * first call, at the end of the warm up, only starts the first cycle.
+   */
+  void EndCycle (void);
+
+  /**
+   * Estimate the lifetime of a device from its cycles.
+   *
+   * \param index The index of the device.
+   * \param steady Whether steady state was reached.
+   */
+  void Extrapolate (uint32_t index, bool steady);
+
+  /**
+   * Record the depletion of a validation device.
+   *
+   * \param estimator The estimator.
+   * \param index The index of the device.
+   * \param oldValue The previous remaining energy.
+   * \param newValue The remaining energy.
+   */
+  static void RemainingEnergyChanged (BatteryLifetimeEstimator *estimator, uint32_t index,
+                                      double oldValue, double newValue);
+
+  /**
+   * Write the results and stop the simulation, if all devices are done.
+   */
+  void CheckDone (void);
+
+  /**
+   * Write the results to OutputFile, once.
+   */
+  void WriteOutputFile (void);
+
+  Time m_warmUp;              //!< The time before the first cycle
+  Time m_cycleDuration;       //!< The duration of a cycle
+  uint32_t m_minCycles;       //!< Cycles compared to detect steady state
+  uint32_t m_maxCycles;       //!< Cycles after which a device is extrapolated anyway
+  double m_tolerance;         //!< The relative spread of steady cycles
+  double m_validationFraction; //!< The fraction of devices run until depletion
+  std::string m_outputFile;   //!< Where the results are written
+  bool m_stopWhenDone;        //!< Whether to stop the simulation when all devices are done
+
+  std::vector<Device> m_devices; //!< The devices
+  bool m_written;             //!< Whether OutputFile was written
+
+  EventId m_cycleEvent;       //!< The end of the current cycle
+  bool m_started;             //!< Whether the warm up is over
+  Ptr<UniformRandomVariable> m_validationRV; //!< Picks the validation devices
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* BATTERY_LIFETIME_ESTIMATOR_H */
@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/columnar-trace-file.h"
+#include "ns3/simulator.h"
+#include "ns3/fatal-error.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include <cstring>
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("ColumnarTraceFile");
+
+std::map<std::string, Ptr<ColumnarTraceFile> > &
+ColumnarTraceFile::GetFiles (void)
+{
+  static std::map<std::string, Ptr<ColumnarTraceFile> > files;
+  return files;
+}
+
+Ptr<const ColumnarTraceFile>
+ColumnarTraceFile::Open (std::string path)
+{
+  NS_LOG_FUNCTION (path);
+
+  std::map<std::string, Ptr<ColumnarTraceFile> > &files = GetFiles ();
+  std::map<std::string, Ptr<ColumnarTraceFile> >::iterator it = files.find (path);
+  if (it != files.end ())
+    {
+      return it->second;
+    }
+
+  if (files.empty ())
+    {
+      Simulator::ScheduleDestroy (&ColumnarTraceFile::Clear);
+    }
+
+  // The constructor is private, so Create<> cannot be used
+  Ptr<ColumnarTraceFile> file = Ptr<ColumnarTraceFile> (new ColumnarTraceFile (path), false);
+  files[path] = file;
+  return file;
+}
+
+ColumnarTraceFile::ColumnarTraceFile (std::string path)
+  : m_file (path),
+    m_nColumns (0),
+    m_nRows (0)
+{
+  NS_LOG_FUNCTION (this << path);
+
+  if (m_file.GetSize () < headerSize || ReadU32 (0) != magic)
+    {
+      NS_FATAL_ERROR (path << " is not a columnar trace file");
+    }
+
+  m_nColumns = ReadU32 (4);
+  m_nRows = ReadU32 (8);
+  m_samplePeriod = Seconds (ReadU32 (12));
+
+  uint64_t expected = headerSize +
+    static_cast<uint64_t> (m_nColumns) * m_nRows * sizeof (float);
+  if (m_file.GetSize () != expected)
+    {
+      NS_FATAL_ERROR (path << " should be " << expected << " bytes long for " <<
+                      m_nColumns << " columns of " << m_nRows << " rows, not " <<
+                      m_file.GetSize ());
+    }
+
+  NS_LOG_DEBUG ("Mapped " << m_nColumns << " series of " << m_nRows <<
+                " measurements every " << m_samplePeriod.GetSeconds () << " s");
+}
+
+ColumnarTraceFile::~ColumnarTraceFile ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint32_t
+ColumnarTraceFile::ReadU32 (uint64_t offset) const
+{
+  // Assemble the value byte by byte, so that the file reads the same on any
+  // host and no alignment is assumed
+  const uint8_t *p = m_file.GetData () + offset;
+  return static_cast<uint32_t> (p[0]) |
+    static_cast<uint32_t> (p[1]) << 8 |
+    static_cast<uint32_t> (p[2]) << 16 |
+    static_cast<uint32_t> (p[3]) << 24;
+}
+
+uint32_t
+ColumnarTraceFile::GetNColumns (void) const
+{
+  return m_nColumns;
+}
+
+uint32_t
+ColumnarTraceFile::GetNRows (void) const
+{
+  return m_nRows;
+}
+
+Time
+ColumnarTraceFile::GetSamplePeriod (void) const
+{
+  return m_samplePeriod;
+}
+
+float
+ColumnarTraceFile::GetValue (uint32_t column, uint32_t row) const
+{
+  NS_ASSERT (column < m_nColumns && row < m_nRows);
+
+  uint32_t bits = ReadU32 (headerSize +
+                           (static_cast<uint64_t> (column) * m_nRows + row) * sizeof (float));
+  float value;
+  std::memcpy (&value, &bits, sizeof (value));
+  return value;
+}
+
+void
+ColumnarTraceFile::ReleaseRows (uint32_t column, uint32_t firstRow, uint32_t endRow) const
+{
+  NS_LOG_FUNCTION (this << column << firstRow << endRow);
+
+  uint64_t offset = headerSize +
+    (static_cast<uint64_t> (column) * m_nRows + firstRow) * sizeof (float);
+  m_file.Release (offset, static_cast<uint64_t> (endRow - firstRow) * sizeof (float));
+}
+
+void
+ColumnarTraceFile::Clear (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  GetFiles ().clear ();
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef COLUMNAR_TRACE_FILE_H
+#define COLUMNAR_TRACE_FILE_H
+
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/mapped-file.h"
+#include <stdint.h>
+#include <map>
+#include <string>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * A file of measurement series, one column per device, memory-mapped once
+ * per simulation and shared by all the applications that replay it.
+ *
+ * The file starts with a 16 byte header of little-endian 32 bit fields:
+ * - the magic number 0x43584653 ("SFXC" in the file),
+ * - the number of columns,
+ * - the number of rows,
+ * - the time between two rows, in seconds.
+ *
+ * The values follow as little-endian 32 bit floats, column after column, so
+ * that the series of a device is contiguous and is read sequentially. Only
+ * the pages that are being read need to be in memory: readers release the
+ * rows they are done with, in chunks, through ReleaseRows.
+ */
+class ColumnarTraceFile : public SimpleRefCount<ColumnarTraceFile>
+{
+public:
+  ~ColumnarTraceFile ();
+
+  /**
+   * Get the trace stored in a file, mapping it if it is not mapped yet.
+   *
+   * \param path The path of the file.
+   * \return The trace, shared by all callers using the same path.
+   */
+  static Ptr<const ColumnarTraceFile> Open (std::string path);
+
+  /**
+   * Get the number of series in the trace.
+   */
+  uint32_t GetNColumns (void) const;
+
+  /**
+   * Get the number of measurements in each series.
+   */
+  uint32_t GetNRows (void) const;
+
+  /**
+   * Get the time between two measurements.
+   */
+  Time GetSamplePeriod (void) const;
+
+  /**
+   * Get a measurement.
+   *
+   * \param column The series, smaller than GetNColumns.
+   * \param row The measurement, smaller than GetNRows.
+   * \return The measurement.
+   */
+  float GetValue (uint32_t column, uint32_t row) const;
+
+  /**
+   * Release the memory used by the first rows of a series, which the caller
+   * will not read again.
+   *
+   * \param column The series.
+   * \param firstRow The first row to release.
+   * \param endRow The row after the last one to release.
+   */
+  void ReleaseRows (uint32_t column, uint32_t firstRow, uint32_t endRow) const;
+
+private:
+  /**
+   * Map a file and check its header.
+   *
+   * \param path The path of the file.
+   */
+  ColumnarTraceFile (std::string path);
+
+  /**
+   * Read a little-endian 32 bit field.
+   *
+   * \param offset The position of the field in the file.
+   */
+  uint32_t ReadU32 (uint64_t offset) const;
+
+  /**
+   * Get the files that are mapped, indexed by path.
+   */
+  static std::map<std::string, Ptr<ColumnarTraceFile> > &GetFiles (void);
+
+  /**
+   * Release all files. Scheduled to run when the simulation is destroyed.
+   */
+  static void Clear (void);
+
+  static const uint32_t magic = 0x43584653; //!< The first field of the header
+  static const uint32_t headerSize = 16;    //!< The size of the header, in bytes
+
+  MappedFile m_file;     //!< The mapped file
+  uint32_t m_nColumns;   //!< The number of series
+  uint32_t m_nRows;      //!< The number of measurements in each series
+  Time m_samplePeriod;   //!< The time between two measurements
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* COLUMNAR_TRACE_FILE_H */
@@ -0,0 +1,363 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/downlink-scheduler.h"
+#include "ns3/end-point-sigfox-mac.h"
+#include "ns3/gateway-sigfox-phy.h"
+#include "ns3/sigfox-net-device.h"
+#include "ns3/sigfox-tag.h"
+#include "ns3/node-list.h"
+#include "ns3/boolean.h"
+#include "ns3/sigfox-radio-configuration.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("DownlinkScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED (DownlinkScheduler);
+
+TypeId
+DownlinkScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DownlinkScheduler")
+    .SetParent<Object> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<DownlinkScheduler> ()
+    .AddAttribute ("Tick",
+                   "The interval between two batches of decisions",
+                   TimeValue (Seconds (1)),
+                   MakeTimeAccessor (&DownlinkScheduler::m_tick),
+                   MakeTimeChecker (NanoSeconds (1)))
+    .AddAttribute ("CollectionDelay",
+                   "How long to wait after the end of the first repetition "
+                   "of a message for the other repetitions to be received",
+                   TimeValue (Seconds (10)),
+                   MakeTimeAccessor (&DownlinkScheduler::m_collectionDelay),
+                   MakeTimeChecker ())
+    .AddAttribute ("ReplyOffset",
+                   "The delay between the end of the first repetition of a "
+                   "message and the start of the downlink reply",
+                   TimeValue (Seconds (20)),
+                   MakeTimeAccessor (&DownlinkScheduler::m_replyOffset),
+                   MakeTimeChecker ())
+    .AddAttribute ("ReplyGuard",
+                   "How long after the opening of the receive window the "
+                   "reply starts, to absorb propagation delay and clock "
+                   "differences",
+                   TimeValue (MilliSeconds (500)),
+                   MakeTimeAccessor (&DownlinkScheduler::m_replyGuard),
+                   MakeTimeChecker (Seconds (0)))
+    .AddAttribute ("RepetitionSpacing",
+                   "The time between the end of a repetition and the start "
+                   "of the next one, used when the first repetition was lost",
+                   TimeValue (Seconds (.525)),
+                   MakeTimeAccessor (&DownlinkScheduler::m_repetitionSpacing),
+                   MakeTimeChecker ())
+    .AddAttribute ("DownlinkSize",
+                   "The payload size of downlink packets, in bytes",
+                   UintegerValue (8),
+                   MakeUintegerAccessor (&DownlinkScheduler::m_downlinkSize),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("LinkMarginOracle",
+                   "Whether the link status of every message should be "
+                   "delivered to its sender without a downlink",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&DownlinkScheduler::m_linkMarginOracle),
+                   MakeBooleanChecker ())
+    .AddTraceSource ("DownlinkScheduled",
+                     "A downlink reply was queued at a gateway",
+                     MakeTraceSourceAccessor (&DownlinkScheduler::m_downlinkScheduled),
+                     "ns3::sigfox::DownlinkScheduler::DownlinkScheduledCallback")
+    .AddTraceSource ("DownlinkDropped",
+                     "No gateway could send a downlink reply in time",
+                     MakeTraceSourceAccessor (&DownlinkScheduler::m_downlinkDropped),
+                     "ns3::sigfox::DownlinkScheduler::DownlinkDroppedCallback");
+  return tid;
+}
+
+DownlinkScheduler::DownlinkScheduler ()
+  : m_linkMarginOracle (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DownlinkScheduler::~DownlinkScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+DownlinkScheduler::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_batchEvent.Cancel ();
+  m_gateways.clear ();
+  m_gatewayIndex.clear ();
+  m_pending.clear ();
+  m_pendingIndex.clear ();
+  Object::DoDispose ();
+}
+
+void
+DownlinkScheduler::AddGateway (Ptr<GatewaySigfoxMac> gateway)
+{
+  NS_LOG_FUNCTION (this << gateway);
+
+  m_gatewayIndex[PeekPointer (gateway)] = m_gateways.size ();
+  m_gateways.push_back (gateway);
+  gateway->SetDownlinkScheduler (this);
+}
+
+uint64_t
+DownlinkScheduler::GetKey (uint32_t deviceId, uint8_t packetNumber)
+{
+  return (static_cast<uint64_t> (deviceId) << 8) | packetNumber;
+}
+
+void
+DownlinkScheduler::NotifyUplink (Ptr<GatewaySigfoxMac> gateway, Ptr<const Packet> packet)
+{
+  NS_LOG_FUNCTION (this << gateway << packet);
+
+  SigfoxTag tag;
+  packet->PeekPacketTag (tag);
+
+  if (!tag.IsDownlinkRequested () && !m_linkMarginOracle)
+    {
+      return;
+    }
+
+  // Gateways also hear the replies of their neighbours, which are not
+  // uplinks
+  enum SigfoxRadioConfiguration rc =
+    gateway->GetLogicalSigfoxChannelHelper ()->GetRadioConfiguration ();
+  if (std::abs (tag.GetFrequency () -
+                GetRadioConfigurationParameters (rc).downlinkCenterFrequencyHz) < 50)
+    {
+      return;
+    }
+
+  std::unordered_map<GatewaySigfoxMac *, uint32_t>::iterator gw =
+    m_gatewayIndex.find (PeekPointer (gateway));
+  if (gw == m_gatewayIndex.end ())
+    {
+      NS_LOG_WARN ("Uplink from a gateway that was not added to the scheduler");
+      return;
+    }
+
+  uint64_t key = GetKey (tag.GetSenderId (), tag.GetPacketNumber ());
+  std::unordered_map<uint64_t, uint32_t>::iterator it = m_pendingIndex.find (key);
+
+  if (it == m_pendingIndex.end ())
+    {
+      // Gateways are notified at the end of the reception: if the first
+      // repetition was lost, work back from the one we got
+      Time duration = Seconds (tag.GetDurationSeconds ());
+      Time firstEnd = Simulator::Now () -
+        Seconds ((duration + m_repetitionSpacing).GetSeconds () * tag.GetRepetitionNumber ());
+
+      if (firstEnd + m_collectionDelay <= Simulator::Now ())
+        {
+          // A late repetition of a message we already took a decision for
+          NS_LOG_DEBUG ("Ignoring late repetition of message " <<
+                        unsigned (tag.GetPacketNumber ()) << " from " << tag.GetSenderId ());
+          return;
+        }
+
+      Request request;
+      request.deviceId = tag.GetSenderId ();
+      request.packetNumber = tag.GetPacketNumber ();
+      request.firstEnd = firstEnd;
+      request.downlinkRequested = tag.IsDownlinkRequested ();
+
+      it = m_pendingIndex.insert (std::make_pair (key, m_pending.size ())).first;
+      m_pending.push_back (request);
+
+      ScheduleBatch ();
+    }
+
+  Request &request = m_pending[it->second];
+  for (std::vector<Candidate>::iterator c = request.candidates.begin ();
+       c != request.candidates.end (); c++)
+    {
+      if (c->gateway == gw->second)
+        {
+          c->rssiDbm = std::max (c->rssiDbm, tag.GetReceivePower ());
+          return;
+        }
+    }
+
+  Candidate candidate;
+  candidate.gateway = gw->second;
+  candidate.rssiDbm = tag.GetReceivePower ();
+  request.candidates.push_back (candidate);
+}
+
+void
+DownlinkScheduler::ScheduleBatch (void)
+{
+  if (m_batchEvent.IsRunning ())
+    {
+      return;
+    }
+
+  // Batches run on tick boundaries
+  int64_t tick = m_tick.GetTimeStep ();
+  Time delay = TimeStep (tick - Simulator::Now ().GetTimeStep () % tick);
+  m_batchEvent = Simulator::Schedule (delay, &DownlinkScheduler::ProcessBatch, this);
+}
+
+void
+DownlinkScheduler::ProcessBatch (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  Time now = Simulator::Now ();
+
+  std::vector<uint32_t> ready;
+  for (uint32_t i = 0; i < m_pending.size (); i++)
+    {
+      if (m_pending[i].firstEnd + m_collectionDelay <= now)
+        {
+          ready.push_back (i);
+        }
+    }
+
+  // Earliest deadline first, so that urgent replies get the gateways first
+  std::sort (ready.begin (), ready.end (),
+             [this] (uint32_t a, uint32_t b)
+             { return m_pending[a].firstEnd < m_pending[b].firstEnd; });
+
+  NS_LOG_DEBUG (ready.size () << " decisions, " << m_pending.size () - ready.size () <<
+                " requests left for later batches");
+
+  for (std::vector<uint32_t>::iterator r = ready.begin (); r != ready.end (); r++)
+    {
+      Request &request = m_pending[*r];
+      Time replyTime = request.firstEnd + m_replyOffset + m_replyGuard;
+
+      // Best RSSI first
+      std::sort (request.candidates.begin (), request.candidates.end (),
+                 [] (const Candidate &a, const Candidate &b)
+                 { return a.rssiDbm > b.rssiDbm; });
+
+      double marginDb = request.candidates.front ().rssiDbm - GatewaySigfoxPhy::sensitivity;
+      int gatewayCount = request.candidates.size ();
+
+      if (m_linkMarginOracle)
+        {
+          ReportLinkStatus (request.deviceId, marginDb, gatewayCount);
+        }
+
+      if (!request.downlinkRequested)
+        {
+          continue;
+        }
+
+      Ptr<Packet> reply = Create<Packet> (m_downlinkSize);
+      SigfoxTag tag;
+      tag.SetSenderId (request.deviceId);
+      tag.SetPacketNumber (request.packetNumber);
+      tag.SetLinkMargin (marginDb);
+      tag.SetGatewayCount (std::min (gatewayCount, 255));
+      reply->AddPacketTag (tag);
+
+      bool scheduled = false;
+      for (std::vector<Candidate>::iterator c = request.candidates.begin ();
+           replyTime >= now && c != request.candidates.end (); c++)
+        {
+          Ptr<GatewaySigfoxMac> gateway = m_gateways[c->gateway];
+          enum SigfoxRadioConfiguration rc =
+            gateway->GetLogicalSigfoxChannelHelper ()->GetRadioConfiguration ();
+          tag.SetFrequency (GetRadioConfigurationParameters (rc).downlinkCenterFrequencyHz);
+          reply->ReplacePacketTag (tag);
+
+          if (gateway->GetDownlinkAvailableTime (reply) <= replyTime)
+            {
+              NS_LOG_DEBUG ("Reply to " << request.deviceId << " through gateway " <<
+                            c->gateway << " (" << c->rssiDbm << " dBm)");
+              gateway->ScheduleDownlink (reply, replyTime - now);
+              m_downlinkScheduled (request.deviceId, c->gateway);
+              scheduled = true;
+              break;
+            }
+        }
+
+      if (!scheduled)
+        {
+          NS_LOG_DEBUG ("No gateway can reply to " << request.deviceId);
+          m_downlinkDropped (request.deviceId);
+        }
+    }
+
+  // Remove from the back, so that the requests that are moved are never
+  // among the ones that are still to be removed
+  std::sort (ready.begin (), ready.end ());
+  for (std::vector<uint32_t>::reverse_iterator r = ready.rbegin (); r != ready.rend (); r++)
+    {
+      RemoveRequest (*r);
+    }
+
+  if (!m_pending.empty ())
+    {
+      ScheduleBatch ();
+    }
+}
+
+void
+DownlinkScheduler::ReportLinkStatus (uint32_t deviceId, double marginDb, int gatewayCount)
+{
+  NS_LOG_FUNCTION (this << deviceId << marginDb << gatewayCount);
+
+  Ptr<Node> node = NodeList::GetNode (deviceId);
+  for (uint32_t i = 0; i < node->GetNDevices (); i++)
+    {
+      Ptr<SigfoxNetDevice> device = DynamicCast<SigfoxNetDevice> (node->GetDevice (i));
+      if (device == 0)
+        {
+          continue;
+        }
+      Ptr<EndPointSigfoxMac> mac = DynamicCast<EndPointSigfoxMac> (device->GetMac ());
+      if (mac != 0)
+        {
+          mac->SetLinkStatus (marginDb, gatewayCount);
+        }
+    }
+}
+
+void
+DownlinkScheduler::RemoveRequest (uint32_t index)
+{
+  m_pendingIndex.erase (GetKey (m_pending[index].deviceId, m_pending[index].packetNumber));
+
+  if (index != m_pending.size () - 1)
+    {
+      m_pending[index] = m_pending.back ();
+      m_pendingIndex[GetKey (m_pending[index].deviceId, m_pending[index].packetNumber)] = index;
+    }
+  m_pending.pop_back ();
+}
+
+} // namespace sigfox
+} // namespace ns3
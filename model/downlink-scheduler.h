@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef DOWNLINK_SCHEDULER_H
+#define DOWNLINK_SCHEDULER_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/event-id.h"
+#include "ns3/traced-callback.h"
+#include "ns3/gateway-sigfox-mac.h"
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * The network server's view of the uplinks received by the gateways, used to
+ * answer the bidirectional procedure of end points.
+ *
+ * Gateways report every uplink they receive. For each message whose sender
+ * requested a downlink (see SigfoxTag::IsDownlinkRequested), the scheduler
+ * remembers which gateways heard it and with what power. Decisions are taken
+ * in batches, once per Tick: when the repetitions of a message have had time
+ * to arrive, the gateway with the best RSSI that can still fit the downlink
+ * in its duty cycle budget is chosen, and the reply is queued to go out
+ * ReplyOffset after the end of the first repetition, when the end point's
+ * receive window opens, plus a ReplyGuard.
+ *
+ * Replies carry the margin of the best gateway over its sensitivity and the
+ * number of gateways that heard the message, which end points can use to
+ * adapt their repetitions and transmission power. With the LinkMarginOracle
+ * attribute, the same report is delivered directly to the end point after
+ * every message, whether it requested a downlink or not.
+ */
+class DownlinkScheduler : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  DownlinkScheduler ();
+  virtual ~DownlinkScheduler ();
+
+  /**
+   * Add a gateway this scheduler can send downlinks through, and have it
+   * report the uplinks it receives.
+   *
+   * \param gateway The MAC of the gateway.
+   */
+  void AddGateway (Ptr<GatewaySigfoxMac> gateway);
+
+  /**
+   * Notify the scheduler that a gateway received an uplink packet.
+   *
+   * \param gateway The MAC of the gateway.
+   * \param packet The packet, tagged with its receive power.
+   */
+  void NotifyUplink (Ptr<GatewaySigfoxMac> gateway, Ptr<const Packet> packet);
+
+  /**
+   * Callback signature for DownlinkScheduled.
+   *
+   * \param deviceId The node id of the end point.
+   * \param gatewayIndex The index of the gateway, in the order of AddGateway.
+   */
+  typedef void (*DownlinkScheduledCallback)(uint32_t deviceId, uint32_t gatewayIndex);
+
+  /**
+   * Callback signature for DownlinkDropped.
+   *
+   * \param deviceId The node id of the end point.
+   */
+  typedef void (*DownlinkDroppedCallback)(uint32_t deviceId);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * A gateway that heard a message.
+   */
+  struct Candidate
+  {
+    uint32_t gateway; //!< The index of the gateway
+    double rssiDbm;   //!< The best receive power among the repetitions
+  };
+
+  /**
+   * A message whose sender waits for a downlink.
+   */
+  struct Request
+  {
+    uint32_t deviceId;     //!< The node id of the sender
+    uint8_t packetNumber;  //!< The number of the message
+    Time firstEnd;         //!< The end of the first repetition
+    bool downlinkRequested; //!< Whether the sender waits for a reply
+    std::vector<Candidate> candidates; //!< The gateways that heard the message
+  };
+
+  /**
+   * Take the decisions for all requests that are ready.
+   */
+  void ProcessBatch (void);
+
+  /**
+   * Make sure that ProcessBatch will run at the next tick.
+   */
+  void ScheduleBatch (void);
+
+  /**
+   * Deliver the link status of a message directly to its sender.
+   *
+   * \param deviceId The node id of the sender.
+   * \param marginDb The margin of the best gateway over its sensitivity.
+   * \param gatewayCount The number of gateways that heard the message.
+   */
+  void ReportLinkStatus (uint32_t deviceId, double marginDb, int gatewayCount);
+
+  /**
+   * Remove a request from the pending ones.
+   *
+   * \param index The position of the request in m_pending.
+   */
+  void RemoveRequest (uint32_t index);
+
+  /**
+   * The key of a message in m_pendingIndex.
+   */
+  static uint64_t GetKey (uint32_t deviceId, uint8_t packetNumber);
+
+  std::vector<Ptr<GatewaySigfoxMac> > m_gateways; //!< The gateways, by index
+  std::unordered_map<GatewaySigfoxMac *, uint32_t> m_gatewayIndex; //!< Index of each gateway
+
+  std::vector<Request> m_pending; //!< The requests waiting for a decision
+  std::unordered_map<uint64_t, uint32_t> m_pendingIndex; //!< Position of each request
+
+  Time m_tick;            //!< The interval between batches of decisions
+  Time m_collectionDelay; //!< Time to wait for repetitions after the first
+  Time m_replyOffset;     //!< Delay of the reply from the end of the first repetition
+  Time m_replyGuard;      //!< Margin after the opening of the receive window
+  uint32_t m_downlinkSize; //!< Payload size of downlink packets
+  Time m_repetitionSpacing; //!< Time between the start of two repetitions, minus their duration
+  bool m_linkMarginOracle; //!< Whether link status is reported for every message
+
+  EventId m_batchEvent;   //!< The next batch of decisions
+
+  TracedCallback<uint32_t, uint32_t> m_downlinkScheduled; //!< A reply was queued
+  TracedCallback<uint32_t> m_downlinkDropped; //!< No gateway could reply in time
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* DOWNLINK_SCHEDULER_H */
@@ -23,6 +23,10 @@
 
 #include "ns3/end-point-sigfox-mac.h"
 #include "ns3/integer.h"
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+#include "ns3/boolean.h"
+#include "ns3/enum.h"
 #include "ns3/sigfox-mac.h"
 #include "ns3/end-point-sigfox-phy.h"
 #include "ns3/sigfox-tag.h"
@@ -60,6 +64,79 @@ EndPointSigfoxMac::GetTypeId (void)
                          IntegerValue (3),
                          MakeIntegerAccessor (&EndPointSigfoxMac::m_nRepetitions),
                          MakeIntegerChecker<uint32_t> (1, 10))
+          .AddAttribute ("BurstMode",
+                         "Whether all repetitions of a packet should be handed "
+                         "to the PHY and to the channel at once",
+                         BooleanValue (false),
+                         MakeBooleanAccessor (&EndPointSigfoxMac::m_burstMode),
+                         MakeBooleanChecker ())
+          .AddAttribute ("EnforceDutyCycle",
+                         "Whether the sub-band duty cycle and the daily message "
+                         "quota should be enforced",
+                         BooleanValue (false),
+                         MakeBooleanAccessor (&EndPointSigfoxMac::m_enforceDutyCycle),
+                         MakeBooleanChecker ())
+          .AddAttribute ("DutyCyclePolicy",
+                         "What to do with a message that cannot be sent because of "
+                         "the duty cycle or the daily message quota",
+                         EnumValue (EndPointSigfoxMac::DEFER),
+                         MakeEnumAccessor (&EndPointSigfoxMac::m_dutyCyclePolicy),
+                         MakeEnumChecker (EndPointSigfoxMac::DEFER, "Defer",
+                                          EndPointSigfoxMac::DROP, "Drop"))
+          .AddAttribute ("AdaptiveLink",
+                         "Whether repetitions and transmission power should "
+                         "follow the link margin reported by the network",
+                         BooleanValue (false),
+                         MakeBooleanAccessor (&EndPointSigfoxMac::m_enableDRAdapt),
+                         MakeBooleanChecker ())
+          .AddAttribute ("MaxRepetitions",
+                         "Number of repetitions restored by the adaptation when the "
+                         "link margin shrinks, 0 for the Repetitions attribute",
+                         UintegerValue (0),
+                         MakeUintegerAccessor (&EndPointSigfoxMac::m_maxRepetitions),
+                         MakeUintegerChecker<uint32_t> (0, 10))
+          .AddAttribute ("LinkMarginHigh",
+                         "Link margin above which the adaptation reduces "
+                         "repetitions and power, in dB",
+                         DoubleValue (20),
+                         MakeDoubleAccessor (&EndPointSigfoxMac::m_linkMarginHighDb),
+                         MakeDoubleChecker<double> ())
+          .AddAttribute ("LinkMarginLow",
+                         "Link margin below which the adaptation restores "
+                         "repetitions and power, in dB",
+                         DoubleValue (10),
+                         MakeDoubleAccessor (&EndPointSigfoxMac::m_linkMarginLowDb),
+                         MakeDoubleChecker<double> ())
+          .AddAttribute ("MinGatewayCount",
+                         "Number of gateways that must receive a message for the "
+                         "adaptation to reduce repetitions and power",
+                         IntegerValue (3),
+                         MakeIntegerAccessor (&EndPointSigfoxMac::m_minGatewayCount),
+                         MakeIntegerChecker<int> (1))
+          .AddAttribute ("TxPowerStep",
+                         "Transmission power reduction of each adaptation step, in dB",
+                         DoubleValue (3),
+                         MakeDoubleAccessor (&EndPointSigfoxMac::m_txPowerStep),
+                         MakeDoubleChecker<double> (0))
+          .AddAttribute ("MinTxPower",
+                         "Lowest transmission power the adaptation can reach, in dBm",
+                         DoubleValue (0),
+                         MakeDoubleAccessor (&EndPointSigfoxMac::m_minTxPower),
+                         MakeDoubleChecker<double> ())
+          .AddAttribute ("MaxTxPower",
+                         "Transmission power restored by the adaptation when the "
+                         "link margin shrinks, in dBm",
+                         DoubleValue (14),
+                         MakeDoubleAccessor (&EndPointSigfoxMac::m_maxTxPower),
+                         MakeDoubleChecker<double> ())
+          .AddTraceSource ("LinkMargin",
+                           "Last link margin reported by the network",
+                           MakeTraceSourceAccessor (&EndPointSigfoxMac::m_lastKnownLinkMargin),
+                           "ns3::TracedValueCallback::Double")
+          .AddTraceSource ("GatewayCount",
+                           "Last number of gateways reported by the network",
+                           MakeTraceSourceAccessor (&EndPointSigfoxMac::m_lastKnownGatewayCount),
+                           "ns3::TracedValueCallback::Int32")
           .AddConstructor<EndPointSigfoxMac> ();
   return tid;
 }
@@ -76,9 +153,22 @@ EndPointSigfoxMac::EndPointSigfoxMac ()
       // Sigfox default
       m_lastKnownLinkMargin (0),
       m_lastKnownGatewayCount (0),
+      m_linkMarginHighDb (20),
+      m_linkMarginLowDb (10),
+      m_minGatewayCount (3),
+      m_txPowerStep (3),
+      m_minTxPower (0),
+      m_maxTxPower (14),
+      m_maxRepetitions (0),
       m_aggregatedDutyCycle (1),
       m_mType (SigfoxMacHeader::CONFIRMED_DATA_UP),
-      m_currentFCnt (0)
+      m_currentFCnt (0),
+      m_messageCount (0),
+      m_burstMode (false),
+      m_downlinkPacketNumber (-1),
+      m_enforceDutyCycle (false),
+      m_dutyCyclePolicy (DEFER),
+      m_suspended (false)
 {
   NS_LOG_FUNCTION (this);
 
@@ -105,37 +195,363 @@ EndPointSigfoxMac::Send (Ptr<Packet> packet)
 {
   NS_LOG_FUNCTION (this << packet);
 
+  if (m_suspended)
+    {
+      NS_LOG_INFO ("Suspended: dropping message");
+      return;
+    }
+
   DoSend (packet);
 }
 
+void
+EndPointSigfoxMac::Suspend (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_suspended = true;
+  m_nextTx.Cancel ();
+  m_nextRetx.Cancel ();
+  m_nextRepetition.Cancel ();
+  m_receiveWindow.Cancel ();
+  for (std::vector<EventId>::iterator it = m_timelineTxEvents.begin ();
+       it != m_timelineTxEvents.end (); it++)
+    {
+      it->Cancel ();
+    }
+  m_timelineTxEvents.clear ();
+  m_sendCount = 0;
+  m_packetReceived = false;
+
+  // A frame on the air ends on its own, and TxFinished puts the radio to
+  // sleep
+  Ptr<EndPointSigfoxPhy> phy = m_phy->GetObject<EndPointSigfoxPhy> ();
+  phy->StopTimeline ();
+  if (phy->GetState () == EndPointSigfoxPhy::RX)
+    {
+      phy->SwitchToStandby ();
+    }
+  if (phy->GetState () == EndPointSigfoxPhy::STANDBY)
+    {
+      phy->SwitchToSleep ();
+    }
+}
+
+void
+EndPointSigfoxMac::Resume (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_suspended = false;
+}
+
+bool
+EndPointSigfoxMac::IsSuspended (void) const
+{
+  return m_suspended;
+}
+
+// Time between the end of a repetition and the start of the next one. This
+// matches the spacing obtained by rescheduling SendToPhy from TxFinished.
+static Time
+GetInterRepetitionGap (void)
+{
+  return NanoSeconds (10) + Seconds (.525);
+}
+
 void
 EndPointSigfoxMac::DoSend (Ptr<Packet> packet)
 {
   NS_LOG_FUNCTION (this);
+
+  // A newer message replaces any message that is waiting for the duty cycle
+  m_nextTx.Cancel ();
+
+  Ptr<EndPointSigfoxPhy> phy = m_phy->GetObject<EndPointSigfoxPhy> ();
+  if (phy->IsTimelineRunning ())
+    {
+      // Wait for the previous message, as the DEFER duty cycle policy does:
+      // a newer message replaces this one
+      NS_LOG_INFO ("Deferring message until the previous one is handled");
+      m_nextTx = Simulator::Schedule (phy->GetTimelineDelayLeft (),
+                                      &EndPointSigfoxMac::DoSend, this, packet);
+      return;
+    }
+
+  if (m_enforceDutyCycle && !CheckDutyCycle (packet))
+    {
+      return;
+    }
+
+  // The receive window is opened after every updateBDP-th message
+  m_downlinkPacketNumber = (msg_cnt + 1 == updateBDP) ? m_appPacketCount : -1;
+
+  if (phy->IsAnalyticalTimelineEnabled ())
+    {
+      SendWithTimeline (packet);
+      return;
+    }
+
+  if (m_burstMode)
+    {
+      SendBurst (packet);
+      return;
+    }
+
   SendToPhy (packet);
 }
 
 void
 EndPointSigfoxMac::SendToPhy (Ptr<Packet> packet)
 {
-  /////////////////////////////////////////////////////////
-  // Add headers, prepare TX parameters and send the packet
-  /////////////////////////////////////////////////////////
+  SendRepetition (packet, m_sendCount, m_appPacketCount,
+                  GetRepetitionFrequency (m_sendCount));
+  // SendRepetition (packet, m_sendCount, m_appPacketCount, m_channelHelper->GetRandomFrequency());
+}
 
+SigfoxTxParameters
+EndPointSigfoxMac::GetTxParameters (void) const
+{
   // Craft LoraTxParameters object
   SigfoxTxParameters params;
-  params.bandwidthHz = 100;
+  params.rc = m_channelHelper->GetRadioConfiguration ();
+  params.bandwidthHz = GetRadioConfigurationParameters (params.rc).uplinkChannelSpacingHz;
   params.nPreamble = 112;
 
+  return params;
+}
+
+bool
+EndPointSigfoxMac::CheckDutyCycle (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+
+  // All uplink channels are in the same sub-band
+  double frequencyHz = LogicalSigfoxChannelHelper::GetFrequencyFromChannelNumber
+      (0, m_channelHelper->GetRadioConfiguration ());
+  Time airTime = SigfoxPhy::GetOnAirTime (packet, GetTxParameters ()) * m_nRepetitions;
+
+  Time waitingTime = m_channelHelper->GetTransmissionWaitingTime (airTime, frequencyHz);
+
+  if (waitingTime.IsStrictlyPositive ())
+    {
+      m_cannotSendBecauseDutyCycle (packet);
+
+      bool defer = (m_dutyCyclePolicy == DEFER);
+      if (!m_dutyCycleCallback.IsNull ())
+        {
+          defer = m_dutyCycleCallback (packet, waitingTime);
+        }
+
+      if (defer && waitingTime != Time::Max ())
+        {
+          NS_LOG_INFO ("Duty cycle: deferring message by " << waitingTime.GetSeconds () << " s");
+          m_nextTx = Simulator::Schedule (waitingTime, &EndPointSigfoxMac::DoSend, this, packet);
+        }
+      else
+        {
+          NS_LOG_INFO ("Duty cycle: dropping message");
+        }
+      return false;
+    }
+
+  m_channelHelper->AddMessage ();
+  return true;
+}
+
+void
+EndPointSigfoxMac::AddTransmission (Time duration, double frequencyHz)
+{
+  if (m_enforceDutyCycle)
+    {
+      m_channelHelper->AddEvent (duration, frequencyHz);
+    }
+}
+
+void
+EndPointSigfoxMac::TagPacket (Ptr<Packet> packet, uint32_t repetition, uint8_t packetNumber)
+{
   NS_LOG_DEBUG ("PacketToSend: " << packet);
   SigfoxTag tag;
-  packet->RemovePacketTag (tag);
-  tag.SetRepetitionNumber (m_sendCount);
-  tag.SetPacketNumber (m_appPacketCount);
+  bool tagged = packet->PeekPacketTag (tag);
+  tag.SetRepetitionNumber (repetition);
+  tag.SetPacketNumber (packetNumber);
   tag.SetSenderId (m_device->GetNode()->GetId());
-  packet->AddPacketTag (tag);
-  m_phy->Send (packet, params, m_channelHelper.GetFrequencyFromChannelSet(), m_txPower);
-  // m_phy->Send (packet, params, m_channelHelper.GetRandomFrequency(), m_txPower);
+  tag.SetDownlinkRequested (packetNumber == m_downlinkPacketNumber);
+  if (tagged)
+    {
+      // Repetitions only update the tag in place
+      packet->ReplacePacketTag (tag);
+    }
+  else
+    {
+      packet->AddPacketTag (tag);
+    }
+}
+
+void
+EndPointSigfoxMac::SendRepetition (Ptr<Packet> packet, uint32_t repetition,
+                                   uint8_t packetNumber, double frequencyHz)
+{
+  /////////////////////////////////////////////////////////
+  // Add headers, prepare TX parameters and send the packet
+  /////////////////////////////////////////////////////////
+
+  SigfoxTxParameters params = GetTxParameters ();
+
+  TagPacket (packet, repetition, packetNumber);
+  AddTransmission (SigfoxPhy::GetOnAirTime (packet, params), frequencyHz);
+  m_phy->Send (packet, params, frequencyHz, m_txPower);
+}
+
+double
+EndPointSigfoxMac::GetRepetitionFrequency (uint32_t repetition)
+{
+  if (m_hoppingSequence)
+    {
+      return m_hoppingSequence->GetFrequency (m_device->GetNode ()->GetId (),
+                                              m_messageCount, repetition,
+                                              m_channelHelper->GetRadioConfiguration ());
+    }
+  return m_channelHelper->GetFrequencyFromChannelSet ();
+}
+
+SigfoxBurstParameters
+EndPointSigfoxMac::GetBurstParameters (Time onAir)
+{
+  SigfoxBurstParameters burst;
+  Time offset = Seconds (0);
+  for (uint32_t rep = 0; rep < m_nRepetitions; rep++)
+    {
+      burst.startOffsets.push_back (offset);
+      burst.frequenciesHz.push_back (GetRepetitionFrequency (rep));
+      offset += onAir + GetInterRepetitionGap ();
+    }
+  return burst;
+}
+
+void
+EndPointSigfoxMac::SendBurst (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+
+  SigfoxTxParameters params = GetTxParameters ();
+  Time onAir = SigfoxPhy::GetOnAirTime (packet, params);
+
+  SigfoxBurstParameters burst = GetBurstParameters (onAir);
+
+  // TxFinished will only be called after the last repetition, but the
+  // receive window is timed from the end of the first one
+  m_burstFirstEnd = Simulator::Now () + onAir + NanoSeconds (10);
+
+  for (uint32_t rep = 0; rep < m_nRepetitions; rep++)
+    {
+      AddTransmission (onAir, burst.frequenciesHz[rep]);
+    }
+
+  TagPacket (packet, 0, m_appPacketCount);
+  m_phy->GetObject<EndPointSigfoxPhy> ()->SendBurst (packet, params, burst, m_txPower);
+}
+
+void
+EndPointSigfoxMac::SendWithTimeline (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+
+  Ptr<EndPointSigfoxPhy> phy = m_phy->GetObject<EndPointSigfoxPhy> ();
+
+  // DoSend defers messages until the previous timeline ends
+  NS_ASSERT (!phy->IsTimelineRunning ());
+
+  SigfoxTxParameters params = GetTxParameters ();
+  Time onAir = SigfoxPhy::GetOnAirTime (packet, params);
+
+  SigfoxBurstParameters burst = GetBurstParameters (onAir);
+
+  // Same bookkeeping TxFinished does after the first repetition
+  bool openReceiveWindow = false;
+  msg_cnt += 1;
+  if (msg_cnt == updateBDP)
+    {
+      openReceiveWindow = true;
+      msg_cnt = 0;
+    }
+
+  EndPointSigfoxPhy::Timeline timeline;
+  Time offset = Seconds (0);
+  m_timelineTxEvents.clear ();
+
+  for (uint32_t rep = 0; rep < m_nRepetitions; rep++)
+    {
+      if (rep > 0)
+        {
+          timeline.push_back ({EndPointSigfoxPhy::STANDBY,
+                               burst.startOffsets[rep] - offset, 0});
+          offset = burst.startOffsets[rep];
+
+          // In burst mode the channel takes care of the following repetitions
+          if (!m_burstMode)
+            {
+              m_timelineTxEvents.push_back (
+                  Simulator::Schedule (offset, &EndPointSigfoxMac::SendRepetition, this,
+                                       packet->Copy (), rep, m_appPacketCount,
+                                       burst.frequenciesHz[rep]));
+            }
+        }
+      timeline.push_back ({EndPointSigfoxPhy::TX, onAir, m_txPower.Get ()});
+      offset += onAir;
+    }
+
+  if (openReceiveWindow)
+    {
+      // The receive window opens 20 seconds after the end of the first
+      // repetition, and stays open for 25 seconds, on the downlink frequency
+      phy->SetFrequency (GetRadioConfigurationParameters (params.rc).downlinkCenterFrequencyHz);
+      Time windowStart = onAir + NanoSeconds (10) + Seconds (20);
+      if (windowStart > offset)
+        {
+          timeline.push_back ({EndPointSigfoxPhy::STANDBY, windowStart - offset, 0});
+          offset = windowStart;
+        }
+      timeline.push_back ({EndPointSigfoxPhy::RX, Seconds (25), 0});
+      offset += Seconds (25);
+
+      // See SendCtrlMessage
+      if (m_sendCtrlMsg)
+        {
+          Ptr<Packet> ctrlMessage = Create<Packet> (1);
+          timeline.push_back ({EndPointSigfoxPhy::STANDBY, Seconds (4), 0});
+          offset += Seconds (4);
+
+          m_timelineTxEvents.push_back (
+              Simulator::Schedule (offset, &EndPointSigfoxMac::SendRepetition, this,
+                                   ctrlMessage, 0, uint8_t (m_appPacketCount + 1),
+                                   GetRepetitionFrequency (0)));
+          timeline.push_back ({EndPointSigfoxPhy::TX,
+                               SigfoxPhy::GetOnAirTime (ctrlMessage, params),
+                               m_txPower.Get ()});
+        }
+    }
+
+  phy->StartTimeline (timeline, EndPointSigfoxPhy::SLEEP);
+
+  // The first repetition starts right away
+  if (m_burstMode)
+    {
+      for (uint32_t rep = 0; rep < m_nRepetitions; rep++)
+        {
+          AddTransmission (onAir, burst.frequenciesHz[rep]);
+        }
+      TagPacket (packet, 0, m_appPacketCount);
+      phy->SendBurst (packet, params, burst, m_txPower);
+    }
+  else
+    {
+      SendRepetition (packet, 0, m_appPacketCount, burst.frequenciesHz[0]);
+    }
+
+  m_appPacketCount += 1;
+  m_messageCount += 1;
 }
 
 //////////////////////////
@@ -145,8 +561,20 @@ EndPointSigfoxMac::SendToPhy (Ptr<Packet> packet)
 void
 EndPointSigfoxMac::Receive (Ptr<Packet const> packet)
 {
-    //NS_LOG_DEBUG ("********************" <<m_packetReceived);
-    
+  NS_LOG_FUNCTION (this << packet);
+
+  // Downlink replies carry the network's view of our uplink. Every device
+  // listening on the downlink frequency hears them, so only keep ours.
+  SigfoxTag tag;
+  if (!packet->PeekPacketTag (tag) || tag.GetSenderId () != m_device->GetNode ()->GetId ())
+    {
+      NS_LOG_DEBUG ("Ignoring a downlink addressed to another device");
+      return;
+    }
+  if (tag.GetGatewayCount () > 0)
+    {
+      SetLinkStatus (tag.GetLinkMargin (), tag.GetGatewayCount ());
+    }
 }
 
 void
@@ -180,13 +608,49 @@ EndPointSigfoxMac::TxFinished (Ptr<const Packet> packet)
 {
   NS_LOG_FUNCTION_NOARGS ();
 
+  // Each repetition has its own SigfoxTag, but shares the payload
   Ptr<Packet> packetCopy = packet->Copy ();
     //NS_LOG_DEBUG ("hahahhaah" <<m_packetReceived);
+  if (m_suspended)
+    {
+      // Suspend cancelled whatever was to follow this frame
+      Ptr<EndPointSigfoxPhy> phy = m_phy->GetObject<EndPointSigfoxPhy> ();
+      if (phy->GetState () == EndPointSigfoxPhy::STANDBY)
+        {
+          phy->SwitchToSleep ();
+        }
+      return;
+    }
   if (m_packetReceived)
     {
       m_phy->GetObject<EndPointSigfoxPhy> ()->SwitchToSleep ();
       m_packetReceived = false;
     }
+  else if (m_burstMode)
+    {
+      // All repetitions went out as a single burst
+      msg_cnt += 1;
+      if (msg_cnt == updateBDP)
+        {
+          Time delay = Seconds (0);
+          if (m_burstFirstEnd + Seconds (20) > Simulator::Now ())
+            {
+              delay = m_burstFirstEnd + Seconds (20) - Simulator::Now ();
+            }
+          m_receiveWindow =
+              Simulator::Schedule (delay, &EndPointSigfoxMac::OpenFirstReceiveWindow, this);
+          msg_cnt = 0;
+        }
+
+      NS_LOG_DEBUG ("Burst of " << m_nRepetitions << " copies sent");
+
+      m_appPacketCount += 1;
+      m_messageCount += 1;
+      if (msg_cnt > 0)
+        {
+          m_phy->GetObject<EndPointSigfoxPhy> ()->SwitchToSleep ();
+        }
+    }
   else
     {
       m_sendCount = m_sendCount + 1;
@@ -196,7 +660,9 @@ EndPointSigfoxMac::TxFinished (Ptr<const Packet> packet)
           msg_cnt += 1;
             if(msg_cnt == updateBDP)
             {
-                Simulator::Schedule (Seconds (20), &EndPointSigfoxMac::OpenFirstReceiveWindow, this);
+                m_receiveWindow = Simulator::Schedule (Seconds (20),
+                                                       &EndPointSigfoxMac::OpenFirstReceiveWindow,
+                                                       this);
                 msg_cnt =0;
             }
         }
@@ -205,13 +671,15 @@ EndPointSigfoxMac::TxFinished (Ptr<const Packet> packet)
 
       if (m_sendCount < m_nRepetitions)
         {
-          Simulator::Schedule (Seconds (.525), &EndPointSigfoxMac::SendToPhy, this, packetCopy);
+          m_nextRepetition =
+              Simulator::Schedule (Seconds (.525), &EndPointSigfoxMac::SendToPhy, this, packetCopy);
         }
 
-      if (m_sendCount == m_nRepetitions)
+      if (m_sendCount >= m_nRepetitions)
         {
           m_sendCount = 0;
           m_appPacketCount += 1;
+          m_messageCount += 1;
             if (msg_cnt > 0)
             {
                 m_phy->GetObject<EndPointSigfoxPhy> ()->SwitchToSleep ();
@@ -225,10 +693,14 @@ EndPointSigfoxMac::OpenFirstReceiveWindow (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
 
-  // Set Phy in Standby mode
-  m_phy->GetObject<EndPointSigfoxPhy> ()->SwitchToRx ();
+  // Listen to the downlink of our radio configuration
+  Ptr<EndPointSigfoxPhy> phy = m_phy->GetObject<EndPointSigfoxPhy> ();
+  phy->SetFrequency (GetRadioConfigurationParameters
+                       (m_channelHelper->GetRadioConfiguration ()).downlinkCenterFrequencyHz);
+  phy->SwitchToRx ();
 
-  Simulator::Schedule (Seconds (25), &EndPointSigfoxMac::CloseFirstReceiveWindow, this);
+  m_receiveWindow =
+      Simulator::Schedule (Seconds (25), &EndPointSigfoxMac::CloseFirstReceiveWindow, this);
 }
 
 void
@@ -257,7 +729,8 @@ EndPointSigfoxMac::SendCtrlMessage (void)
     //{
         m_packetReceived = true;
         Ptr<Packet> ctrlMessage = Create<Packet> (1);
-        Simulator::Schedule (Seconds (4), &EndPointSigfoxMac::SendToPhy, this, ctrlMessage);
+        m_nextRepetition =
+            Simulator::Schedule (Seconds (4), &EndPointSigfoxMac::SendToPhy, this, ctrlMessage);
    // }
    /* else{
         m_phy->GetObject<EndPointSigfoxPhy> ()->SwitchToSleep ();
@@ -277,6 +750,13 @@ EndPointSigfoxMac::ResetCtrlcntr (void)
 // Setters and Getters //
 /////////////////////////
 
+void
+EndPointSigfoxMac::SetMaxNumberOfTransmissions (uint8_t maxNumbTx)
+{
+  NS_LOG_FUNCTION (this << unsigned (maxNumbTx));
+  m_maxNumbTx = maxNumbTx;
+}
+
 uint8_t
 EndPointSigfoxMac::GetMaxNumberOfTransmissions (void)
 {
@@ -284,13 +764,77 @@ EndPointSigfoxMac::GetMaxNumberOfTransmissions (void)
   return m_maxNumbTx;
 }
 
+uint32_t
+EndPointSigfoxMac::GetRepetitions (void) const
+{
+  return m_nRepetitions;
+}
+
+void
+EndPointSigfoxMac::SetLinkStatus (double marginDb, int gatewayCount)
+{
+  NS_LOG_FUNCTION (this << marginDb << gatewayCount);
+
+  m_lastKnownLinkMargin = marginDb;
+  m_lastKnownGatewayCount = gatewayCount;
+
+  if (!m_enableDRAdapt)
+    {
+      return;
+    }
+
+  if (m_maxRepetitions == 0)
+    {
+      // Nothing was adapted yet, so this is the configured Repetitions
+      m_maxRepetitions = m_nRepetitions;
+    }
+
+  if (marginDb < m_linkMarginLowDb || gatewayCount < m_minGatewayCount)
+    {
+      // Losing messages is worse than spending energy: restore everything at
+      // once rather than climbing back one step per report
+      m_nRepetitions = m_maxRepetitions;
+      m_txPower = m_maxTxPower;
+    }
+  else if (marginDb >= m_linkMarginHighDb)
+    {
+      // Repetitions cost a full message each, so they go first
+      if (m_nRepetitions > 1)
+        {
+          m_nRepetitions = 1;
+        }
+      else if (m_txPower.Get () - m_txPowerStep >= m_minTxPower)
+        {
+          m_txPower = m_txPower.Get () - m_txPowerStep;
+        }
+    }
+
+  NS_LOG_DEBUG ("Margin " << marginDb << " dB from " << gatewayCount << " gateways: " <<
+                m_nRepetitions << " repetitions at " << m_txPower << " dBm");
+}
+
+void
+EndPointSigfoxMac::SetDutyCycleCallback (DutyCycleCallback callback)
+{
+  m_dutyCycleCallback = callback;
+}
+
+int64_t
+EndPointSigfoxMac::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  m_uniformRV->SetStream (stream);
+  return 1 + SigfoxMac::AssignStreams (stream + 1);
+}
+
 void
 EndPointSigfoxMac::AddSubBand (double startFrequency, double endFrequency, double dutyCycle,
                                double maxTxPowerDbm)
 {
   NS_LOG_FUNCTION_NOARGS ();
 
-  m_channelHelper.AddSubBand (startFrequency, endFrequency, dutyCycle, maxTxPowerDbm);
+  m_channelHelper->AddSubBand (startFrequency, endFrequency, dutyCycle, maxTxPowerDbm);
 }
 
 double
@@ -306,6 +850,14 @@ void EndPointSigfoxMac::BDPFrequency(int BDPF)
     updateBDP = BDPF;
 }
 
+void
+EndPointSigfoxMac::SetFrequencyHoppingSequence (Ptr<FrequencyHoppingSequence> sequence)
+{
+  NS_LOG_FUNCTION (this << sequence);
+
+  m_hoppingSequence = sequence;
+}
+
 uint8_t
 EndPointSigfoxMac::GetTransmissionPower (void)
 {
@@ -26,8 +26,10 @@
 
 #include "ns3/sigfox-mac.h"
 #include "ns3/sigfox-mac-header.h"
+#include "ns3/frequency-hopping-sequence.h"
 #include "ns3/random-variable-stream.h"
 #include "ns3/traced-value.h"
+#include <vector>
 
 namespace ns3 {
 namespace sigfox {
@@ -40,6 +42,23 @@ class EndPointSigfoxMac : public SigfoxMac
 public:
   static TypeId GetTypeId (void);
 
+  /**
+   * What to do with a message that cannot be sent yet because of duty cycle
+   * or daily quota limitations.
+   */
+  enum DutyCyclePolicy
+  {
+    DEFER, //!< Send the message as soon as the limits allow it
+    DROP   //!< Discard the message
+  };
+
+  /**
+   * Callback invoked when a message is blocked by duty cycle or daily quota
+   * limitations, with the message and the time until it can be sent. Return
+   * true to defer the message, false to drop it.
+   */
+  typedef Callback<bool, Ptr<const Packet>, Time> DutyCycleCallback;
+
   EndPointSigfoxMac ();
   virtual ~EndPointSigfoxMac ();
 
@@ -70,6 +89,26 @@ public:
   */
   virtual void SendToPhy (Ptr<Packet> packet);
 
+  /**
+   * Stop sending, e.g., because the battery is depleted. A message that is
+   * waiting for the duty cycle is discarded, as are the messages sent until
+   * Resume is called. The following repetitions of the message being sent,
+   * its receive window and its control message are cancelled, and the radio
+   * is put to sleep as soon as the frame on the air, or the burst already
+   * handed to the channel, ends.
+   */
+  void Suspend (void);
+
+  /**
+   * Accept messages again after Suspend.
+   */
+  void Resume (void);
+
+  /**
+   * \returns Whether the MAC is suspended.
+   */
+  bool IsSuspended (void) const;
+
   ///////////////////////
   // Receiving methods //
   ///////////////////////
@@ -188,6 +227,45 @@ public:
   void SendCtrlMessage (void);
     void ResetCtrlcntr (void);
     void BDPFrequency(int BDPF);
+
+  /**
+   * Use a deterministic hopping sequence to choose the frequency of each
+   * repetition, instead of drawing it at random from the channel set.
+   *
+   * \param sequence The sequence, typically shared by all devices.
+   */
+  void SetFrequencyHoppingSequence (Ptr<FrequencyHoppingSequence> sequence);
+
+  /**
+   * Set the callback that decides whether a message blocked by duty cycle or
+   * daily quota limitations is deferred or dropped. If no callback is set, the
+   * DutyCyclePolicy attribute is used.
+   *
+   * \param callback The callback.
+   */
+  void SetDutyCycleCallback (DutyCycleCallback callback);
+
+  /**
+   * Report the quality of this device's uplink, as seen by the network.
+   *
+   * If adaptation is enabled, a generous margin heard by many gateways first
+   * brings the repetitions down to one and then lowers the transmission power
+   * one step at a time; a margin below the low threshold, or too few gateways,
+   * immediately restores the maximum power and number of repetitions.
+   *
+   * \param marginDb The margin of the best gateway over its sensitivity, in dB.
+   * \param gatewayCount The number of gateways that received the message.
+   */
+  void SetLinkStatus (double marginDb, int gatewayCount);
+
+  /**
+   * Get the number of repetitions currently used for each message.
+   */
+  uint32_t GetRepetitions (void) const;
+
+  // Implementation of the SigfoxMac interface
+  virtual int64_t AssignStreams (int64_t stream);
+
 protected:
 
   bool m_sendCtrlMsg = true;
@@ -198,7 +276,8 @@ protected:
     int msg_cnt=0;
     int updateBDP; //BiDirectionalProcedureFrequency
   /**
-   * Enable Data Rate adaptation during the retransmission procedure.
+   * Enable the adaptation of repetitions and transmission power to the
+   * reported link margin.
    */
   bool m_enableDRAdapt;
 
@@ -257,6 +336,88 @@ private:
    */
   Time GetNextTransmissionDelay (void);
 
+  /**
+   * Build the parameters used for uplink transmissions.
+   */
+  SigfoxTxParameters GetTxParameters (void) const;
+
+  /**
+   * Check the duty cycle and daily quota limitations before a new message is
+   * sent, deferring or dropping it if they are exceeded.
+   *
+   * \param packet The message to send.
+   * \return Whether the message can be sent right away.
+   */
+  bool CheckDutyCycle (Ptr<Packet> packet);
+
+  /**
+   * Register the airtime of a transmission with the channel helper, if duty
+   * cycle enforcement is enabled.
+   *
+   * \param duration The duration of the transmission.
+   * \param frequencyHz The frequency of the transmission.
+   */
+  void AddTransmission (Time duration, double frequencyHz);
+
+  /**
+   * Tag a packet as the given repetition of a message.
+   *
+   * \param packet The packet to tag.
+   * \param repetition The repetition number of this copy.
+   * \param packetNumber The number of the message this copy belongs to.
+   */
+  void TagPacket (Ptr<Packet> packet, uint32_t repetition, uint8_t packetNumber);
+
+  /**
+   * Tag a packet as the given repetition of a message and pass it to the PHY.
+   *
+   * \param packet The packet to send.
+   * \param repetition The repetition number of this copy.
+   * \param packetNumber The number of the message this copy belongs to.
+   * \param frequencyHz The frequency to send this copy on.
+   */
+  void SendRepetition (Ptr<Packet> packet, uint32_t repetition, uint8_t packetNumber,
+                       double frequencyHz);
+
+  /**
+   * Get the frequency a repetition of the current message should be sent on.
+   *
+   * \param repetition The repetition number.
+   * \return The frequency, in Hz.
+   */
+  double GetRepetitionFrequency (uint32_t repetition);
+
+  /**
+   * Compute the start offset and the frequency of each repetition of a
+   * message.
+   *
+   * \param onAir The duration of a single repetition.
+   * \return The description of the burst of repetitions.
+   */
+  SigfoxBurstParameters GetBurstParameters (Time onAir);
+
+  /**
+   * Send all the repetitions of a message with a single call to the PHY.
+   *
+   * Used instead of SendToPhy when the BurstMode attribute is set.
+   *
+   * \param packet The packet to send.
+   */
+  void SendBurst (Ptr<Packet> packet);
+
+  /**
+   * Send all the repetitions of a message, and the following bidirectional
+   * procedure if needed, as a single precomputed PHY timeline.
+   *
+   * Used instead of SendToPhy when the PHY's AnalyticalTimeline attribute is
+   * set: the only events that are scheduled are the transmissions of the
+   * repetitions after the first one. DoSend defers messages until the
+   * previous timeline has ended.
+   *
+   * \param packet The packet to send.
+   */
+  void SendWithTimeline (Ptr<Packet> packet);
+
   /**
    * The event of retransmitting a packet in a consecutive moment if an ACK is not received.
    *
@@ -272,6 +433,23 @@ private:
    */
   EventId m_nextRetx;
 
+  /**
+   * The transmission of the next repetition of the message being sent, or
+   * of the control message that follows its receive window.
+   */
+  EventId m_nextRepetition;
+
+  /**
+   * The opening or the closing of the receive window.
+   */
+  EventId m_receiveWindow;
+
+  /**
+   * The transmissions scheduled by SendWithTimeline for the message being
+   * sent.
+   */
+  std::vector<EventId> m_timelineTxEvents;
+
   /**
    * The last known link margin.
    *
@@ -289,6 +467,14 @@ private:
    */
   TracedValue<int> m_lastKnownGatewayCount;
 
+  double m_linkMarginHighDb; //!< Margin above which resources are reduced
+  double m_linkMarginLowDb;  //!< Margin below which resources are restored
+  int m_minGatewayCount;     //!< Gateways needed to reduce resources
+  double m_txPowerStep;      //!< Power reduction per adaptation step, in dB
+  double m_minTxPower;       //!< Lowest power the adaptation can reach, in dBm
+  double m_maxTxPower;       //!< The power restored by the adaptation, in dBm
+  uint32_t m_maxRepetitions; //!< The repetitions restored by the adaptation
+
   /**
    * The aggregated duty cycle this device needs to respect across all sub-bands.
    */
@@ -302,6 +488,54 @@ private:
   uint8_t m_currentFCnt;
 
   uint32_t m_nRepetitions;
+
+  /**
+   * The hopping sequence used to choose frequencies, if any.
+   */
+  Ptr<FrequencyHoppingSequence> m_hoppingSequence;
+
+  /**
+   * The number of messages sent so far. Unlike m_appPacketCount, this does
+   * not wrap after 256 messages, so that it can index the hopping sequence.
+   */
+  uint32_t m_messageCount;
+
+  /**
+   * Whether all repetitions are handed to the PHY at once.
+   */
+  bool m_burstMode;
+
+  /**
+   * The end of the first repetition of the last burst, that is needed to time
+   * the receive window.
+   */
+  Time m_burstFirstEnd;
+
+  /**
+   * The number of the message that requests a downlink, or -1 if the current
+   * message does not.
+   */
+  int m_downlinkPacketNumber;
+
+  /**
+   * Whether duty cycle and daily quota limitations are enforced.
+   */
+  bool m_enforceDutyCycle;
+
+  /**
+   * What to do with messages that are blocked, if no callback is set.
+   */
+  enum DutyCyclePolicy m_dutyCyclePolicy;
+
+  /**
+   * The callback deciding what to do with messages that are blocked.
+   */
+  DutyCycleCallback m_dutyCycleCallback;
+
+  /**
+   * Whether messages are discarded, see Suspend.
+   */
+  bool m_suspended;
 };
 
 
@@ -19,10 +19,14 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include "ns3/end-point-sigfox-phy.h"
 #include "ns3/simulator.h"
 #include "ns3/sigfox-tag.h"
+#include "ns3/sigfox-radio-energy-model.h"
 #include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/boolean.h"
 
 namespace ns3 {
 namespace sigfox {
@@ -55,7 +59,17 @@ EndPointSigfoxPhy::GetTypeId (void)
                      "The current state of the device",
                      MakeTraceSourceAccessor
                        (&EndPointSigfoxPhy::m_state),
-                     "ns3::TracedValueCallback::EndPointSigfoxPhy::State");
+                     "ns3::TracedValueCallback::EndPointSigfoxPhy::State")
+    .AddAttribute ("AnalyticalTimeline",
+                   "Whether the MAC should precompute the radio activity of "
+                   "each message and hand it to the PHY as a timeline. This "
+                   "saves most of the per-repetition events, but state and "
+                   "energy traces only report the start and the end of each "
+                   "timeline. A message sent while a timeline is running "
+                   "waits for its end, and is replaced by any newer message.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&EndPointSigfoxPhy::m_analyticalTimeline),
+                   MakeBooleanChecker ());
   return tid;
 }
 
@@ -63,7 +77,11 @@ EndPointSigfoxPhy::GetTypeId (void)
 // These will then be changed by helpers.
 EndPointSigfoxPhy::EndPointSigfoxPhy () :
   m_state (SLEEP),
-  m_frequency (868.1)
+  m_frequency (868.1e6),
+  m_nEnergyModels (0),
+  m_analyticalTimeline (false),
+  m_timelineRunning (false),
+  m_timelineFinalState (SLEEP)
 {
 }
 
@@ -77,19 +95,20 @@ const double EndPointSigfoxPhy::sensitivity = -126;   // dBm, 10% packet error r
 bool
 EndPointSigfoxPhy::IsTransmitting (void)
 {
-  return m_state == TX;
+  return GetState () == TX;
 }
 
 bool
-EndPointSigfoxPhy::IsOnFrequency (double frequencyMHz)
+EndPointSigfoxPhy::IsOnFrequency (double frequencyHz)
 {
-  return m_frequency == frequencyMHz;
+  // Half the width of an ultra narrow band channel
+  return std::abs (m_frequency - frequencyHz) < 50;
 }
 
 void
-EndPointSigfoxPhy::SetFrequency (double frequencyMHz)
+EndPointSigfoxPhy::SetFrequency (double frequencyHz)
 {
-  m_frequency = frequencyMHz;
+  m_frequency = frequencyHz;
 }
 
 void
@@ -99,6 +118,8 @@ EndPointSigfoxPhy:: SwitchToStandby(void)
 
   m_state = STANDBY;
 
+  NotifyEnergyModels (STANDBY, 0);
+
   // Notify listeners of the state change
   for (Listeners::const_iterator i = m_listeners.begin (); i != m_listeners.end (); i++)
     {
@@ -115,6 +136,8 @@ EndPointSigfoxPhy::SwitchToRx (void)
 
   m_state = RX;
 
+  NotifyEnergyModels (RX, 0);
+
   // Notify listeners of the state change
   for (Listeners::const_iterator i = m_listeners.begin (); i != m_listeners.end (); i++)
     {
@@ -131,6 +154,8 @@ EndPointSigfoxPhy::SwitchToTx (double txPowerDbm)
 
   m_state = TX;
 
+  NotifyEnergyModels (TX, txPowerDbm);
+
   // Notify listeners of the state change
   for (Listeners::const_iterator i = m_listeners.begin (); i != m_listeners.end (); i++)
     {
@@ -147,6 +172,8 @@ EndPointSigfoxPhy::SwitchToSleep (void)
 
   m_state = SLEEP;
 
+  NotifyEnergyModels (SLEEP, 0);
+
   // Notify listeners of the state change
   for (Listeners::const_iterator i = m_listeners.begin (); i != m_listeners.end (); i++)
     {
@@ -154,14 +181,155 @@ EndPointSigfoxPhy::SwitchToSleep (void)
     }
 }
 
+void
+EndPointSigfoxPhy::NotifyEnergyModels (State newState, double txPowerDbm)
+{
+  for (uint8_t i = 0; i < m_nEnergyModels; i++)
+    {
+      m_energyModels[i]->NotifyPhyStateChange (newState, txPowerDbm);
+    }
+}
+
+void
+EndPointSigfoxPhy::NotifyListeners (State newState, double txPowerDbm)
+{
+  for (Listeners::const_iterator i = m_listeners.begin (); i != m_listeners.end (); i++)
+    {
+      switch (newState)
+        {
+        case SLEEP:
+          (*i)->NotifySleep ();
+          break;
+        case STANDBY:
+          (*i)->NotifyStandby ();
+          break;
+        case TX:
+          (*i)->NotifyTxStart (txPowerDbm);
+          break;
+        case RX:
+          (*i)->NotifyRxStart ();
+          break;
+        }
+    }
+}
+
 EndPointSigfoxPhy::State
 EndPointSigfoxPhy::GetState (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
 
+  if (m_timelineRunning)
+    {
+      // Find the segment we are in. Segments are half-open intervals, so
+      // that at the boundary between two segments we are in the latter.
+      Time elapsed = Simulator::Now () - m_timelineStart;
+      for (Timeline::const_iterator it = m_timeline.begin (); it != m_timeline.end (); it++)
+        {
+          if (elapsed < it->duration)
+            {
+              return it->state;
+            }
+          elapsed -= it->duration;
+        }
+      return m_timelineFinalState;
+    }
+
   return m_state;
 }
 
+bool
+EndPointSigfoxPhy::IsAnalyticalTimelineEnabled (void) const
+{
+  return m_analyticalTimeline;
+}
+
+bool
+EndPointSigfoxPhy::IsTimelineRunning (void) const
+{
+  return m_timelineRunning;
+}
+
+Time
+EndPointSigfoxPhy::GetTimelineDelayLeft (void) const
+{
+  if (!m_timelineRunning)
+    {
+      return Seconds (0);
+    }
+  return Simulator::GetDelayLeft (m_timelineEnd);
+}
+
+const EndPointSigfoxPhy::Timeline &
+EndPointSigfoxPhy::GetTimeline (void) const
+{
+  return m_timeline;
+}
+
+void
+EndPointSigfoxPhy::StartTimeline (const Timeline &timeline, State finalState)
+{
+  NS_LOG_FUNCTION (this << timeline.size () << finalState);
+
+  NS_ASSERT (!m_timelineRunning);
+  NS_ASSERT (m_state == STANDBY || m_state == SLEEP);
+  NS_ASSERT (!timeline.empty ());
+
+  Time totalDuration = Seconds (0);
+  for (Timeline::const_iterator it = timeline.begin (); it != timeline.end (); it++)
+    {
+      totalDuration += it->duration;
+    }
+
+  m_timeline = timeline;
+  m_timelineStart = Simulator::Now ();
+  m_timelineFinalState = finalState;
+  m_timelineRunning = true;
+
+  const TimelineSegment first = m_timeline.front ();
+  m_state = first.state;
+  m_timelineEnd = Simulator::Schedule (totalDuration, &EndPointSigfoxPhy::EndTimeline, this);
+
+  for (uint8_t i = 0; i < m_nEnergyModels && m_timelineRunning; i++)
+    {
+      m_energyModels[i]->NotifyPhyTimelineStart (m_timeline);
+    }
+  if (!m_timelineRunning)
+    {
+      // Stopped by a depletion the energy models noticed
+      return;
+    }
+  NotifyListeners (first.state, first.txPowerDbm);
+}
+
+void
+EndPointSigfoxPhy::StopTimeline (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (!m_timelineRunning)
+    {
+      return;
+    }
+
+  m_timelineEnd.Cancel ();
+  m_timelineFinalState = STANDBY;
+  EndTimeline ();
+}
+
+void
+EndPointSigfoxPhy::EndTimeline (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_timelineRunning = false;
+  m_timeline.clear ();
+
+  m_state = m_timelineFinalState;
+
+  NotifyEnergyModels (m_timelineFinalState, 0);
+  NotifyListeners (m_timelineFinalState, 0);
+}
+
 void
 EndPointSigfoxPhy::RegisterListener (EndPointSigfoxPhyListener *listener)
 {
@@ -178,5 +346,33 @@ EndPointSigfoxPhy::UnregisterListener (EndPointSigfoxPhyListener *listener)
     }
 }
 
+void
+EndPointSigfoxPhy::RegisterEnergyModel (SigfoxRadioEnergyModel *model)
+{
+  NS_LOG_FUNCTION (this << model);
+
+  NS_ABORT_MSG_IF (m_nEnergyModels == maxEnergyModels,
+                   "Cannot attach more than " << unsigned (maxEnergyModels)
+                   << " energy models to the same EndPointSigfoxPhy");
+
+  m_energyModels[m_nEnergyModels++] = model;
+}
+
+void
+EndPointSigfoxPhy::UnregisterEnergyModel (SigfoxRadioEnergyModel *model)
+{
+  NS_LOG_FUNCTION (this << model);
+
+  for (uint8_t i = 0; i < m_nEnergyModels; i++)
+    {
+      if (m_energyModels[i] == model)
+        {
+          // Keep the array compact, order does not matter
+          m_energyModels[i] = m_energyModels[--m_nEnergyModels];
+          return;
+        }
+    }
+}
+
 }
 }
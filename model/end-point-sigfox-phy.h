@@ -27,12 +27,15 @@
 #include "ns3/nstime.h"
 #include "ns3/mobility-model.h"
 #include "ns3/node.h"
+#include "ns3/event-id.h"
 #include "ns3/sigfox-phy.h"
+#include <vector>
 
 namespace ns3 {
 namespace sigfox {
 
 class SigfoxChannel;
+class SigfoxRadioEnergyModel;
 
 /**
  * Receive notifications about PHY events.
@@ -121,6 +124,23 @@ public:
     RX
   };
 
+  /**
+   * A stretch of time the radio spends in a single state, used to describe
+   * the whole activity of the device for a message in advance.
+   */
+  struct TimelineSegment
+  {
+    State state;        //!< The state the radio is in during this segment
+    Time duration;      //!< How long the radio stays in this state
+    double txPowerDbm;  //!< The nominal tx power, only meaningful for TX
+  };
+
+  /**
+   * A sequence of consecutive segments, starting when it is handed to
+   * StartTimeline.
+   */
+  typedef std::vector<TimelineSegment> Timeline;
+
   static TypeId GetTypeId (void);
 
   // Constructor and destructor
@@ -129,7 +149,7 @@ public:
 
   // Implementation of SigfoxPhy's pure virtual functions
   virtual void StartReceive (Ptr<Packet> packet, double rxPowerDbm,
-                             Time duration, double frequencyMHz) = 0;
+                             Time duration, double frequencyHz) = 0;
 
   // Implementation of SigfoxPhy's pure virtual functions
   virtual void EndReceive (Ptr<Packet> packet,
@@ -137,10 +157,25 @@ public:
 
   // Implementation of SigfoxPhy's pure virtual functions
   virtual void Send (Ptr<Packet> packet, SigfoxTxParameters txParams,
-                     double frequencyMHz, double txPowerDbm) = 0;
+                     double frequencyHz, double txPowerDbm) = 0;
+
+  /**
+   * Send all the repetitions of a message as a single burst.
+   *
+   * The packet is only tagged and handed to the channel once, and the
+   * channel delivers each repetition at its own offset and frequency. The
+   * TxFinished callback is called once, after the last repetition.
+   *
+   * \param packet The payload shared by all repetitions.
+   * \param txParams The desired transmission parameters.
+   * \param burst The start offset and frequency of each repetition.
+   * \param txPowerDbm The power in dBm with which to transmit.
+   */
+  virtual void SendBurst (Ptr<Packet> packet, SigfoxTxParameters txParams,
+                          const SigfoxBurstParameters &burst, double txPowerDbm) = 0;
 
   // Implementation of SigfoxPhy's pure virtual functions
-  virtual bool IsOnFrequency (double frequencyMHz);
+  virtual bool IsOnFrequency (double frequencyHz);
 
   // Implementation of SigfoxPhy's pure virtual functions
   virtual bool IsTransmitting (void);
@@ -149,11 +184,12 @@ public:
    * Set the frequency this EndPoint will listen on.
    *
    * Should a packet be transmitted on a frequency different than that the
-   * SigfoxPhy is listening on, the packet will be discarded.
+   * SigfoxPhy is listening on, the packet will be discarded. Frequencies are
+   * in Hz, as the channel passes them.
    *
-   * \param The frequency [MHz] to listen to.
+   * \param frequencyHz The frequency [Hz] to listen to.
    */
-  void SetFrequency (double frequencyMHz);
+  void SetFrequency (double frequencyHz);
 
   /**
    * Return the state this End Device is currently in.
@@ -162,6 +198,51 @@ public:
    */
   EndPointSigfoxPhy::State GetState (void);
 
+  /**
+   * Whether the upper layer should drive this PHY with precomputed timelines
+   * (see StartTimeline) instead of switching state explicitly.
+   *
+   * \return True if the AnalyticalTimeline attribute is set.
+   */
+  bool IsAnalyticalTimelineEnabled (void) const;
+
+  /**
+   * Run a precomputed timeline.
+   *
+   * The radio goes through the segments of the timeline without any further
+   * intervention, and then rests in finalState. Only the start and the end
+   * of the timeline are notified to energy models and listeners, and
+   * GetState derives the current state from the timeline. While a timeline
+   * is running Send only puts packets on the channel: the caller is
+   * responsible for calling it at the start of each TX segment.
+   *
+   * \param timeline The segments the radio will go through.
+   * \param finalState The state the radio is left in at the end.
+   */
+  void StartTimeline (const Timeline &timeline, State finalState);
+
+  /**
+   * \return True if a timeline started with StartTimeline is still running.
+   */
+  bool IsTimelineRunning (void) const;
+
+  /**
+   * \return The time until the running timeline ends, zero if none is
+   * running.
+   */
+  Time GetTimelineDelayLeft (void) const;
+
+  /**
+   * Stop the running timeline, if any, and leave the radio in STANDBY.
+   */
+  void StopTimeline (void);
+
+  /**
+   * \return The timeline started with StartTimeline, empty if none is
+   * running.
+   */
+  const Timeline &GetTimeline (void) const;
+
   /**
    * Switch to the STANDBY state.
    */
@@ -193,8 +274,34 @@ public:
    */
   void UnregisterListener (EndPointSigfoxPhyListener *listener);
 
+  /**
+   * Add an energy model to the set of models that are notified of state
+   * changes through a direct call, bypassing the virtual listener interface.
+   *
+   * This is the path used by SigfoxRadioEnergyModelHelper: since every state
+   * switch of every device ends up in the energy model, avoiding the
+   * listener indirection matters in large simulations. Other observers
+   * should keep using RegisterListener.
+   *
+   * \param model the energy model to be notified
+   */
+  void RegisterEnergyModel (SigfoxRadioEnergyModel *model);
+
+  /**
+   * Remove an energy model previously added with RegisterEnergyModel.
+   *
+   * \param model the energy model to be unregistered
+   */
+  void UnregisterEnergyModel (SigfoxRadioEnergyModel *model);
+
   static const double sensitivity; //!< The sensitivity of this device
 
+  /**
+   * The maximum number of energy models that can be attached to a PHY with
+   * RegisterEnergyModel.
+   */
+  static const uint8_t maxEnergyModels = 2;
+
 protected:
   /**
    * Switch to the RX state
@@ -206,6 +313,27 @@ protected:
    */
   void SwitchToTx (double txPowerDbm);
 
+  /**
+   * Notify the registered energy models that the PHY switched state.
+   *
+   * \param newState the state the PHY is now in
+   * \param txPowerDbm the nominal tx power, only meaningful for TX
+   */
+  void NotifyEnergyModels (State newState, double txPowerDbm);
+
+  /**
+   * Notify the registered listeners that the PHY switched state.
+   *
+   * \param newState the state the PHY is now in
+   * \param txPowerDbm the nominal tx power, only meaningful for TX
+   */
+  void NotifyListeners (State newState, double txPowerDbm);
+
+  /**
+   * Leave the running timeline and go to m_timelineFinalState.
+   */
+  void EndTimeline (void);
+
   /**
    * Trace source for when a packet is lost because it was transmitted on a
    * frequency different from the one this SigfoxPhy was configured to
@@ -215,7 +343,7 @@ protected:
 
   TracedValue<State> m_state; //!< The state this PHY is currently in.
 
-  double m_frequency; //!< The frequency this device is listening on
+  double m_frequency; //!< The frequency this device is listening on, in Hz
 
   /**
    * typedef for a list of EndPointSigfoxPhyListener
@@ -227,6 +355,27 @@ protected:
   typedef std::vector<EndPointSigfoxPhyListener *>::iterator ListenersI;
 
   Listeners m_listeners; //!< PHY listeners
+
+  /**
+   * Energy models notified directly on every state change. This is a small
+   * fixed-size array rather than a vector so that dispatch needs neither an
+   * allocation nor a virtual call.
+   */
+  SigfoxRadioEnergyModel *m_energyModels[maxEnergyModels];
+
+  uint8_t m_nEnergyModels; //!< The number of valid entries in m_energyModels
+
+  bool m_analyticalTimeline; //!< Whether the upper layer should use timelines
+
+  bool m_timelineRunning; //!< Whether a timeline is currently running
+
+  Timeline m_timeline; //!< The timeline that is currently running
+
+  Time m_timelineStart; //!< The time the current timeline was started
+
+  State m_timelineFinalState; //!< The state to go to when the timeline ends
+
+  EventId m_timelineEnd; //!< The event closing the current timeline
 };
 
 } /* namespace ns3 */
@@ -0,0 +1,278 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/energy-timeline-recorder.h"
+#include "ns3/simulator.h"
+#include "ns3/node.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("EnergyTimelineRecorder");
+
+NS_OBJECT_ENSURE_REGISTERED (EnergyTimelineRecorder);
+
+namespace {
+
+const uint32_t timelineMagic = 0x524c5445;
+const uint32_t timelineVersion = 1;
+
+/**
+ * Append the bytes of a value to a buffer.
+ */
+template <typename T>
+void
+Append (std::vector<char> &buffer, T value)
+{
+  const char *bytes = reinterpret_cast<const char *> (&value);
+  buffer.insert (buffer.end (), bytes, bytes + sizeof (T));
+}
+
+/**
+ * Read a value from a file, returning false at the end of the file.
+ */
+template <typename T>
+bool
+Read (std::ifstream &in, T &value)
+{
+  return static_cast<bool> (in.read (reinterpret_cast<char *> (&value), sizeof (T)));
+}
+
+} // namespace
+
+TypeId
+EnergyTimelineRecorder::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::EnergyTimelineRecorder")
+    .SetParent<Object> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<EnergyTimelineRecorder> ()
+    .AddAttribute ("OutputFile",
+                   "The file the timeline is written to",
+                   StringValue ("energy-timeline.bin"),
+                   MakeStringAccessor (&EnergyTimelineRecorder::m_outputFile),
+                   MakeStringChecker ())
+    .AddAttribute ("BufferSegments",
+                   "The number of segments kept in memory before they are "
+                   "written out",
+                   UintegerValue (1 << 16),
+                   MakeUintegerAccessor (&EnergyTimelineRecorder::m_bufferSegments),
+                   MakeUintegerChecker<uint32_t> (1))
+  ;
+  return tid;
+}
+
+EnergyTimelineRecorder::EnergyTimelineRecorder ()
+  : m_nPending (0)
+{
+  NS_LOG_FUNCTION (this);
+
+  // Keep the recorder alive until the end of the simulation
+  Simulator::ScheduleDestroy (&EnergyTimelineRecorder::Flush, Ptr<EnergyTimelineRecorder> (this));
+}
+
+EnergyTimelineRecorder::~EnergyTimelineRecorder ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+EnergyTimelineRecorder::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  Flush ();
+  if (m_out.is_open ())
+    {
+      m_out.close ();
+    }
+  m_channels.clear ();
+  Object::DoDispose ();
+}
+
+uint32_t
+EnergyTimelineRecorder::AddChannel (uint32_t device, Signal signal)
+{
+  Channel channel;
+  channel.device = device;
+  channel.signal = signal;
+  channel.hasValue = false;
+  channel.lastValue = 0;
+  channel.lastTime = 0;
+  m_channels.push_back (channel);
+  return m_channels.size () - 1;
+}
+
+void
+EnergyTimelineRecorder::Add (Ptr<SdcEnergySource> source)
+{
+  NS_LOG_FUNCTION (this << source);
+
+  uint32_t device = source->GetNode () != 0 ? source->GetNode ()->GetId () : m_channels.size ();
+
+  source->TraceConnectWithoutContext ("SdcRemainingEnergy",
+    MakeBoundCallback (&EnergyTimelineRecorder::Record, this, AddChannel (device, REMAINING)));
+
+  DeviceEnergyModelContainer models = source->FindDeviceEnergyModels ("ns3::SigfoxRadioEnergyModel");
+  if (models.GetN () > 0)
+    {
+      Ptr<DeviceEnergyModel> radio = models.Get (0);
+      radio->TraceConnectWithoutContext ("SystemCurrent",
+        MakeBoundCallback (&EnergyTimelineRecorder::Record, this, AddChannel (device, CURRENT)));
+      radio->TraceConnectWithoutContext ("TotalEnergyConsumption",
+        MakeBoundCallback (&EnergyTimelineRecorder::Record, this, AddChannel (device, CONSUMPTION)));
+    }
+}
+
+void
+EnergyTimelineRecorder::Add (EnergySourceContainer sources)
+{
+  for (EnergySourceContainer::Iterator i = sources.Begin (); i != sources.End (); ++i)
+    {
+      Ptr<SdcEnergySource> source = DynamicCast<SdcEnergySource> (*i);
+      NS_ABORT_MSG_IF (source == 0, "Only SdcEnergySource timelines can be recorded");
+      Add (source);
+    }
+}
+
+void
+EnergyTimelineRecorder::Record (EnergyTimelineRecorder *recorder, uint32_t channelIndex,
+                                double oldValue, double newValue)
+{
+  Channel &channel = recorder->m_channels[channelIndex];
+  double now = Simulator::Now ().GetSeconds ();
+
+  if (channel.hasValue && newValue == channel.lastValue)
+    {
+      // Same run
+      return;
+    }
+
+  if (!channel.pending.empty () && channel.lastTime == now)
+    {
+      // Only keep the last of several changes at the same time
+      channel.pending.back () = newValue;
+    }
+  else
+    {
+      channel.pending.push_back (now);
+      channel.pending.push_back (newValue);
+      recorder->m_nPending++;
+    }
+  channel.hasValue = true;
+  channel.lastValue = newValue;
+  channel.lastTime = now;
+
+  if (recorder->m_nPending >= recorder->m_bufferSegments)
+    {
+      recorder->Flush ();
+    }
+}
+
+void
+EnergyTimelineRecorder::Flush (void)
+{
+  NS_LOG_FUNCTION (this << m_nPending);
+
+  if (!m_out.is_open ())
+    {
+      if (m_channels.empty ())
+        {
+          return;
+        }
+      m_out.open (m_outputFile.c_str (), std::ios::binary | std::ios::trunc);
+      NS_ABORT_MSG_IF (!m_out.is_open (), "Cannot open " << m_outputFile);
+      std::vector<char> header;
+      Append (header, timelineMagic);
+      Append (header, timelineVersion);
+      m_out.write (header.data (), header.size ());
+    }
+
+  if (m_nPending == 0)
+    {
+      return;
+    }
+
+  std::vector<char> buffer;
+  buffer.reserve (m_nPending * 2 * sizeof (double) + m_channels.size () * 9);
+  for (std::vector<Channel>::iterator c = m_channels.begin (); c != m_channels.end (); c++)
+    {
+      if (c->pending.empty ())
+        {
+          continue;
+        }
+      Append (buffer, c->device);
+      Append (buffer, c->signal);
+      Append (buffer, static_cast<uint32_t> (c->pending.size () / 2));
+      const char *bytes = reinterpret_cast<const char *> (c->pending.data ());
+      buffer.insert (buffer.end (), bytes, bytes + c->pending.size () * sizeof (double));
+      c->pending.clear ();
+    }
+  m_nPending = 0;
+
+  m_out.write (buffer.data (), buffer.size ());
+  m_out.flush ();
+}
+
+void
+EnergyTimelineRecorder::ConvertToCsv (std::string input, std::string output)
+{
+  std::ifstream in (input.c_str (), std::ios::binary);
+  NS_ABORT_MSG_IF (!in.is_open (), "Cannot open " << input);
+  std::ofstream out (output.c_str ());
+  NS_ABORT_MSG_IF (!out.is_open (), "Cannot open " << output);
+
+  uint32_t magic, version;
+  if (!Read (in, magic) || !Read (in, version) || magic != timelineMagic)
+    {
+      NS_FATAL_ERROR (input << " is not an energy timeline");
+    }
+  NS_ABORT_MSG_IF (version != timelineVersion,
+                   "Unsupported energy timeline version " << version);
+
+  static const char *names[] = {"current", "consumption", "remaining"};
+
+  out.precision (9);
+  out << "device,signal,timeS,value" << std::endl;
+
+  uint32_t device, count;
+  uint8_t signal;
+  while (Read (in, device))
+    {
+      if (!Read (in, signal) || !Read (in, count) || signal > REMAINING)
+        {
+          NS_FATAL_ERROR (input << " is truncated or corrupted");
+        }
+      for (uint32_t i = 0; i < count; i++)
+        {
+          double time, value;
+          if (!Read (in, time) || !Read (in, value))
+            {
+              NS_FATAL_ERROR (input << " is truncated");
+            }
+          out << device << "," << names[signal] << "," << time << "," << value << "\n";
+        }
+    }
+}
+
+} // namespace sigfox
+} // namespace ns3
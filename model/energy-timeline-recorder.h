@@ -0,0 +1,152 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef ENERGY_TIMELINE_RECORDER_H
+#define ENERGY_TIMELINE_RECORDER_H
+
+#include "ns3/object.h"
+#include "ns3/energy-source-container.h"
+#include "ns3/sdc-energy-source.h"
+#include <stdint.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * Record the energy timeline of some devices to a compact binary file.
+ *
+ * For each device, the recorder follows the SystemCurrent and
+ * TotalEnergyConsumption of its SigfoxRadioEnergyModel and the
+ * SdcRemainingEnergy of its SdcEnergySource. Each signal is kept in memory
+ * as run-length-encoded segments: a new (time, value) segment only starts
+ * when the value changes, and of several changes at the same time only the
+ * last is kept. Once BufferSegments segments are pending, they are written
+ * out at once, through a file that stays open for the whole run.
+ *
+ * The file is made of a header of two 32 bit fields, the magic number
+ * 0x524c5445 ("ETLR" in the file) and the version 1, followed by blocks:
+ * - the device, as a 32 bit integer,
+ * - the signal, as an 8 bit integer (see Signal),
+ * - the number of segments, as a 32 bit integer,
+ * - the segments, each the start time in seconds and the value, as 64 bit
+ *   floats.
+ * All fields are little-endian. The segments of a signal are in time order
+ * across blocks. ConvertToCsv turns a file into text.
+ */
+class EnergyTimelineRecorder : public Object
+{
+public:
+  /**
+   * The signals that are recorded.
+   */
+  enum Signal
+  {
+    CURRENT = 0,      //!< The current drawn by the radio
+    CONSUMPTION = 1,  //!< The charge drawn by the radio so far
+    REMAINING = 2     //!< The energy left in the source
+  };
+
+  static TypeId GetTypeId (void);
+
+  EnergyTimelineRecorder ();
+  virtual ~EnergyTimelineRecorder ();
+
+  /**
+   * Record the timeline of a device.
+   *
+   * \param source The energy source of the device. Its first
+   * SigfoxRadioEnergyModel, if any, is recorded too.
+   */
+  void Add (Ptr<SdcEnergySource> source);
+
+  /**
+   * Record the timeline of some devices.
+   *
+   * \param sources The energy sources of the devices, all SdcEnergySource.
+   */
+  void Add (EnergySourceContainer sources);
+
+  /**
+   * Write the pending segments to OutputFile.
+   */
+  void Flush (void);
+
+  /**
+   * Convert a file written by a recorder to CSV, one segment per line:
+   *
+   *   device,signal,timeS,value
+   *
+   * with the signal as current, consumption or remaining.
+   *
+   * \param input The recorded file.
+   * \param output The CSV file to write.
+   */
+  static void ConvertToCsv (std::string input, std::string output);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * A signal of a device.
+   */
+  struct Channel
+  {
+    uint32_t device;      //!< The device
+    uint8_t signal;       //!< The Signal
+    bool hasValue;        //!< Whether a segment was ever recorded
+    double lastValue;     //!< The value of the last segment
+    double lastTime;      //!< The start of the last segment
+    std::vector<double> pending; //!< Pending segments, as time and value pairs
+  };
+
+  /**
+   * Add a channel.
+   *
+   * \param device The device.
+   * \param signal The signal.
+   * \return The index of the channel.
+   */
+  uint32_t AddChannel (uint32_t device, Signal signal);
+
+  /**
+   * Trace sink of all signals.
+   *
+   * \param recorder The recorder.
+   * \param channel The index of the channel.
+   * \param oldValue The previous value.
+   * \param newValue The value.
+   */
+  static void Record (EnergyTimelineRecorder *recorder, uint32_t channel,
+                      double oldValue, double newValue);
+
+  std::string m_outputFile;       //!< The file the segments are written to
+  uint32_t m_bufferSegments;      //!< The number of pending segments that triggers a write
+
+  std::vector<Channel> m_channels; //!< The recorded signals
+  uint32_t m_nPending;            //!< The number of pending segments
+  std::ofstream m_out;            //!< OutputFile, once opened
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* ENERGY_TIMELINE_RECORDER_H */
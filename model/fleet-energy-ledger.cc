@@ -0,0 +1,495 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/fleet-energy-ledger.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("FleetEnergyLedger");
+
+NS_OBJECT_ENSURE_REGISTERED (FleetEnergyLedger);
+
+TypeId
+FleetEnergyLedger::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::FleetEnergyLedger")
+    .SetParent<Object> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<FleetEnergyLedger> ()
+    .AddAttribute ("InitialEnergyJ",
+                   "The energy of a full battery",
+                   DoubleValue (10),
+                   MakeDoubleAccessor (&FleetEnergyLedger::m_initialEnergyJ),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("SupplyVoltageV",
+                   "The supply voltage of the batteries",
+                   DoubleValue (3.0),
+                   MakeDoubleAccessor (&FleetEnergyLedger::m_supplyVoltageV),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("LowBatteryThreshold",
+                   "The energy at which a battery is depleted, as a fraction "
+                   "of the initial energy",
+                   DoubleValue (0.10),
+                   MakeDoubleAccessor (&FleetEnergyLedger::m_lowBatteryTh),
+                   MakeDoubleChecker<double> (0, 1))
+    .AddAttribute ("SelfDischargeParameter",
+                   "The fraction of energy that survives a month of "
+                   "self-discharge, as in SdcEnergySource",
+                   DoubleValue (0.97),
+                   MakeDoubleAccessor (&FleetEnergyLedger::m_sdcParameter),
+                   MakeDoubleChecker<double> (0, 1))
+    .AddAttribute ("TxCurrentA",
+                   "The radio tx current, if there is no tx current model",
+                   DoubleValue (0.047),
+                   MakeDoubleAccessor (&FleetEnergyLedger::m_txCurrentA),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("RxCurrentA",
+                   "The radio rx current",
+                   DoubleValue (0.019),
+                   MakeDoubleAccessor (&FleetEnergyLedger::m_rxCurrentA),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("StandbyCurrentA",
+                   "The radio standby current",
+                   DoubleValue (0.0043),
+                   MakeDoubleAccessor (&FleetEnergyLedger::m_standbyCurrentA),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("SleepCurrentA",
+                   "The radio sleep current, a few uA for typical "
+                   "Sigfox transceivers",
+                   DoubleValue (1.5e-6),
+                   MakeDoubleAccessor (&FleetEnergyLedger::m_sleepCurrentA),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("TxCurrentModel",
+                   "The model used to compute the tx current",
+                   PointerValue (),
+                   MakePointerAccessor (&FleetEnergyLedger::m_txCurrentModel),
+                   MakePointerChecker<SigfoxTxCurrentModel> ())
+    .AddAttribute ("CheckInterval",
+                   "The time between two checks for depleted batteries, or "
+                   "zero to only check at state changes",
+                   TimeValue (Hours (1)),
+                   MakeTimeAccessor (&FleetEnergyLedger::m_checkInterval),
+                   MakeTimeChecker ())
+  ;
+  return tid;
+}
+
+FleetEnergyLedger::FleetEnergyLedger ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+FleetEnergyLedger::~FleetEnergyLedger ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+FleetEnergyLedger::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_checkEvent.Cancel ();
+  // The callbacks point back to the energy models
+  m_depletionCallbacks.clear ();
+  m_txCurrentModel = 0;
+  Object::DoDispose ();
+}
+
+uint32_t
+FleetEnergyLedger::AddDevice (Callback<void> depletionCallback)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_remainingJ.push_back (m_initialEnergyJ);
+  m_consumed.push_back (0);
+  m_currentA.push_back (m_sleepCurrentA);
+  m_lastUpdateS.push_back (Simulator::Now ().GetSeconds ());
+  m_state.push_back (EndPointSigfoxPhy::SLEEP);
+  m_depleted.push_back (false);
+  m_depletionCallbacks.push_back (depletionCallback);
+
+  if (!m_checkEvent.IsRunning () && m_checkInterval.IsStrictlyPositive ())
+    {
+      m_checkEvent = Simulator::Schedule (m_checkInterval, &FleetEnergyLedger::PeriodicCheck, this);
+    }
+
+  return m_remainingJ.size () - 1;
+}
+
+uint32_t
+FleetEnergyLedger::GetNDevices (void) const
+{
+  return m_remainingJ.size ();
+}
+
+double
+FleetEnergyLedger::GetStateCurrentA (EndPointSigfoxPhy::State state, double txPowerDbm) const
+{
+  switch (state)
+    {
+    case EndPointSigfoxPhy::STANDBY:
+      return m_standbyCurrentA;
+    case EndPointSigfoxPhy::TX:
+      if (m_txCurrentModel)
+        {
+          return m_txCurrentModel->CalcTxCurrent (txPowerDbm);
+        }
+      return m_txCurrentA;
+    case EndPointSigfoxPhy::RX:
+      return m_rxCurrentA;
+    case EndPointSigfoxPhy::SLEEP:
+      return m_sleepCurrentA;
+    default:
+      NS_FATAL_ERROR ("FleetEnergyLedger:Undefined radio state:" << state);
+    }
+}
+
+void
+FleetEnergyLedger::SetState (uint32_t index, EndPointSigfoxPhy::State state, double txPowerDbm)
+{
+  SetCurrent (index, state, GetStateCurrentA (state, txPowerDbm));
+}
+
+void
+FleetEnergyLedger::SetCurrent (uint32_t index, EndPointSigfoxPhy::State state, double currentA)
+{
+  NS_LOG_FUNCTION (this << index << state << currentA);
+  NS_ASSERT (index < m_remainingJ.size ());
+
+  AdvanceDevice (index, Simulator::Now ().GetSeconds ());
+  m_state[index] = state;
+  m_currentA[index] = currentA;
+  CheckDepletion (index);
+}
+
+void
+FleetEnergyLedger::AdvanceDevice (uint32_t index, double now)
+{
+  double dt = now - m_lastUpdateS[index];
+  double powerW = m_currentA[index] * m_supplyVoltageV;
+  double remaining = m_remainingJ[index];
+
+  if (m_sdcParameter > 0 && m_sdcParameter < 1)
+    {
+      // Same closed form as SdcEnergySource::SdcCalculateRemainingEnergy
+      double param = -std::log (m_sdcParameter) / 2592000;
+      double tmp = powerW / param;
+      remaining = std::exp (-param * dt) * (remaining + tmp) - tmp;
+    }
+  else
+    {
+      remaining -= powerW * dt;
+    }
+
+  m_remainingJ[index] = std::max (remaining, 0.0);
+  m_consumed[index] += m_currentA[index] * dt;
+  m_lastUpdateS[index] = now;
+}
+
+void
+FleetEnergyLedger::Advance (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  const uint32_t n = m_remainingJ.size ();
+  const double now = Simulator::Now ().GetSeconds ();
+  const double voltage = m_supplyVoltageV;
+
+  // Plain loops over the arrays, without calls or branches, so that the
+  // compiler can turn them into vector instructions
+  double *remaining = m_remainingJ.data ();
+  double *consumed = m_consumed.data ();
+  double *lastUpdate = m_lastUpdateS.data ();
+  const double *current = m_currentA.data ();
+
+  if (m_sdcParameter > 0 && m_sdcParameter < 1)
+    {
+      const double param = -std::log (m_sdcParameter) / 2592000;
+      for (uint32_t i = 0; i < n; i++)
+        {
+          double dt = now - lastUpdate[i];
+          double tmp = current[i] * voltage / param;
+          remaining[i] = std::exp (-param * dt) * (remaining[i] + tmp) - tmp;
+        }
+    }
+  else
+    {
+      for (uint32_t i = 0; i < n; i++)
+        {
+          remaining[i] -= current[i] * voltage * (now - lastUpdate[i]);
+        }
+    }
+
+  for (uint32_t i = 0; i < n; i++)
+    {
+      remaining[i] = std::max (remaining[i], 0.0);
+      consumed[i] += current[i] * (now - lastUpdate[i]);
+      lastUpdate[i] = now;
+    }
+
+  const double lowJ = m_lowBatteryTh * m_initialEnergyJ;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      if (!m_depleted[i] && remaining[i] <= lowJ)
+        {
+          CheckDepletion (i);
+        }
+    }
+}
+
+void
+FleetEnergyLedger::CheckDepletion (uint32_t index)
+{
+  if (m_depleted[index] || m_remainingJ[index] > m_lowBatteryTh * m_initialEnergyJ)
+    {
+      return;
+    }
+
+  NS_LOG_DEBUG ("Device " << index << " is depleted");
+  m_depleted[index] = true;
+  if (!m_depletionCallbacks[index].IsNull ())
+    {
+      m_depletionCallbacks[index] ();
+    }
+}
+
+void
+FleetEnergyLedger::PeriodicCheck (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  Advance ();
+  m_checkEvent = Simulator::Schedule (m_checkInterval, &FleetEnergyLedger::PeriodicCheck, this);
+}
+
+double
+FleetEnergyLedger::GetRemainingEnergy (uint32_t index)
+{
+  NS_ASSERT (index < m_remainingJ.size ());
+  AdvanceDevice (index, Simulator::Now ().GetSeconds ());
+  return m_remainingJ[index];
+}
+
+double
+FleetEnergyLedger::GetTotalEnergyConsumption (uint32_t index)
+{
+  NS_ASSERT (index < m_remainingJ.size ());
+  AdvanceDevice (index, Simulator::Now ().GetSeconds ());
+  return m_consumed[index];
+}
+
+double
+FleetEnergyLedger::GetCurrentA (uint32_t index) const
+{
+  NS_ASSERT (index < m_remainingJ.size ());
+  return m_currentA[index];
+}
+
+EndPointSigfoxPhy::State
+FleetEnergyLedger::GetState (uint32_t index) const
+{
+  NS_ASSERT (index < m_remainingJ.size ());
+  return static_cast<EndPointSigfoxPhy::State> (m_state[index]);
+}
+
+bool
+FleetEnergyLedger::IsDepleted (uint32_t index) const
+{
+  NS_ASSERT (index < m_remainingJ.size ());
+  return m_depleted[index];
+}
+
+// -------------------------------------------------------------------------- //
+
+NS_OBJECT_ENSURE_REGISTERED (LedgerRadioEnergyModel);
+
+TypeId
+LedgerRadioEnergyModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LedgerRadioEnergyModel")
+    .SetParent<DeviceEnergyModel> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<LedgerRadioEnergyModel> ()
+  ;
+  return tid;
+}
+
+LedgerRadioEnergyModel::LedgerRadioEnergyModel ()
+  : m_index (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+LedgerRadioEnergyModel::~LedgerRadioEnergyModel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+LedgerRadioEnergyModel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_phy)
+    {
+      m_phy->UnregisterListener (this);
+    }
+  m_phy = 0;
+  m_ledger = 0;
+  m_energyDepletionCallback.Nullify ();
+  DeviceEnergyModel::DoDispose ();
+}
+
+void
+LedgerRadioEnergyModel::Attach (Ptr<FleetEnergyLedger> ledger, Ptr<EndPointSigfoxPhy> phy)
+{
+  NS_LOG_FUNCTION (this << ledger << phy);
+  NS_ASSERT (m_ledger == 0);
+
+  m_ledger = ledger;
+  m_index = ledger->AddDevice (MakeCallback (&LedgerRadioEnergyModel::HandleEnergyDepletion, this));
+  m_phy = phy;
+  m_phy->RegisterListener (this);
+}
+
+Ptr<FleetEnergyLedger>
+LedgerRadioEnergyModel::GetLedger (void) const
+{
+  return m_ledger;
+}
+
+uint32_t
+LedgerRadioEnergyModel::GetIndex (void) const
+{
+  return m_index;
+}
+
+void
+LedgerRadioEnergyModel::SetEnergyDepletionCallback (Callback<void> callback)
+{
+  NS_LOG_FUNCTION (this);
+  m_energyDepletionCallback = callback;
+}
+
+void
+LedgerRadioEnergyModel::SetEnergySource (Ptr<EnergySource> source)
+{
+  NS_FATAL_ERROR ("LedgerRadioEnergyModel draws from a FleetEnergyLedger, not an EnergySource");
+}
+
+double
+LedgerRadioEnergyModel::GetTotalEnergyConsumption (void) const
+{
+  return m_ledger->GetTotalEnergyConsumption (m_index);
+}
+
+void
+LedgerRadioEnergyModel::ChangeState (int newState)
+{
+  Notify (static_cast<EndPointSigfoxPhy::State> (newState), 0);
+}
+
+void
+LedgerRadioEnergyModel::HandleEnergyDepletion (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_energyDepletionCallback.IsNull ())
+    {
+      m_energyDepletionCallback ();
+    }
+}
+
+void
+LedgerRadioEnergyModel::HandleEnergyRecharged (void)
+{
+}
+
+void
+LedgerRadioEnergyModel::HandleEnergyChanged (void)
+{
+}
+
+void
+LedgerRadioEnergyModel::NotifyRxStart (void)
+{
+  Notify (EndPointSigfoxPhy::RX, 0);
+}
+
+void
+LedgerRadioEnergyModel::NotifyTxStart (double txPowerDbm)
+{
+  Notify (EndPointSigfoxPhy::TX, txPowerDbm);
+}
+
+void
+LedgerRadioEnergyModel::NotifySleep (void)
+{
+  Notify (EndPointSigfoxPhy::SLEEP, 0);
+}
+
+void
+LedgerRadioEnergyModel::NotifyStandby (void)
+{
+  Notify (EndPointSigfoxPhy::STANDBY, 0);
+}
+
+double
+LedgerRadioEnergyModel::DoGetCurrentA (void) const
+{
+  return m_ledger->GetCurrentA (m_index);
+}
+
+void
+LedgerRadioEnergyModel::Notify (EndPointSigfoxPhy::State state, double txPowerDbm)
+{
+  NS_LOG_FUNCTION (this << state << txPowerDbm);
+
+  if (m_phy && m_phy->IsTimelineRunning ())
+    {
+      // The PHY only notifies the start of a timeline: draw its average
+      // current until it notifies the final state
+      const EndPointSigfoxPhy::Timeline &timeline = m_phy->GetTimeline ();
+      double charge = 0;
+      double duration = 0;
+      for (EndPointSigfoxPhy::Timeline::const_iterator it = timeline.begin ();
+           it != timeline.end (); it++)
+        {
+          charge += m_ledger->GetStateCurrentA (it->state, it->txPowerDbm) *
+                    it->duration.GetSeconds ();
+          duration += it->duration.GetSeconds ();
+        }
+      if (duration > 0)
+        {
+          m_ledger->SetCurrent (m_index, state, charge / duration);
+          return;
+        }
+    }
+
+  m_ledger->SetState (m_index, state, txPowerDbm);
+}
+
+} // namespace sigfox
+} // namespace ns3
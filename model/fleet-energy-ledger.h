@@ -0,0 +1,265 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef FLEET_ENERGY_LEDGER_H
+#define FLEET_ENERGY_LEDGER_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/callback.h"
+#include "ns3/device-energy-model.h"
+#include "ns3/end-point-sigfox-phy.h"
+#include "ns3/sigfox-tx-current-model.h"
+#include <vector>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * \ingroup energy
+ *
+ * The batteries of a fleet of identical devices, kept in one place.
+ *
+ * Instead of one SdcEnergySource and one SigfoxRadioEnergyModel per device,
+ * that update each other at every state change, the ledger stores the
+ * remaining energy, the time of the last update, the current draw and the
+ * radio state of all devices in contiguous arrays. A state change only
+ * brings its own device up to date, and Advance brings the whole fleet up
+ * to date in tight loops over the arrays, that the compiler can vectorize.
+ *
+ * Batteries follow the same self-discharge law as SdcEnergySource, with
+ * parameters shared by the whole fleet. Depletion is detected when a device
+ * changes state and every CheckInterval, so it is reported at most one
+ * CheckInterval late for devices that stay in the same state.
+ *
+ * Devices are attached through LedgerRadioEnergyModel, a thin
+ * DeviceEnergyModel that forwards PHY state changes to the ledger.
+ */
+class FleetEnergyLedger : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  FleetEnergyLedger ();
+  virtual ~FleetEnergyLedger ();
+
+  /**
+   * Add a device with a full battery, in SLEEP state.
+   *
+   * \param depletionCallback Called when the battery of the device crosses
+   * the low battery threshold.
+   * \return The index of the device in the ledger.
+   */
+  uint32_t AddDevice (Callback<void> depletionCallback);
+
+  /**
+   * \return The number of devices in the ledger.
+   */
+  uint32_t GetNDevices (void) const;
+
+  /**
+   * \param state A radio state.
+   * \param txPowerDbm The nominal tx power, only used if state is TX.
+   * \returns The current drawn by a radio in that state.
+   */
+  double GetStateCurrentA (EndPointSigfoxPhy::State state, double txPowerDbm) const;
+
+  /**
+   * Bring a device up to date, and switch its radio state.
+   *
+   * \param index The device.
+   * \param state The new state.
+   * \param txPowerDbm The nominal tx power, only used if state is TX.
+   */
+  void SetState (uint32_t index, EndPointSigfoxPhy::State state, double txPowerDbm);
+
+  /**
+   * Bring a device up to date, and make it draw an arbitrary current, for
+   * instance the average current of a PHY timeline.
+   *
+   * \param index The device.
+   * \param state The state the radio is in.
+   * \param currentA The current drawn from now on.
+   */
+  void SetCurrent (uint32_t index, EndPointSigfoxPhy::State state, double currentA);
+
+  /**
+   * Bring all devices up to date, and report the ones whose battery got
+   * depleted.
+   */
+  void Advance (void);
+
+  /**
+   * \param index The device.
+   * \return The energy left in the battery of the device, in Joules.
+   */
+  double GetRemainingEnergy (uint32_t index);
+
+  /**
+   * \param index The device.
+   * \return The charge drawn by the radio of the device so far.
+   */
+  double GetTotalEnergyConsumption (uint32_t index);
+
+  /**
+   * \param index The device.
+   * \return The current the device is drawing.
+   */
+  double GetCurrentA (uint32_t index) const;
+
+  /**
+   * \param index The device.
+   * \return The radio state of the device.
+   */
+  EndPointSigfoxPhy::State GetState (uint32_t index) const;
+
+  /**
+   * \param index The device.
+   * \return Whether the battery of the device crossed the low threshold.
+   */
+  bool IsDepleted (uint32_t index) const;
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * Bring one device up to date.
+   *
+   * \param index The device.
+   * \param now The current time, in seconds.
+   */
+  void AdvanceDevice (uint32_t index, double now);
+
+  /**
+   * Report the depletion of a device, if its battery crossed the low
+   * threshold.
+   *
+   * \param index The device.
+   */
+  void CheckDepletion (uint32_t index);
+
+  /**
+   * Advance the fleet, and schedule the next check.
+   */
+  void PeriodicCheck (void);
+
+  // Parameters shared by the fleet
+  double m_initialEnergyJ;    //!< The energy of a full battery
+  double m_supplyVoltageV;    //!< The supply voltage
+  double m_lowBatteryTh;      //!< The low threshold, as a fraction of m_initialEnergyJ
+  double m_sdcParameter;      //!< The fraction of energy left after a month of self-discharge
+  double m_txCurrentA;        //!< The tx current, if there is no tx current model
+  double m_rxCurrentA;        //!< The rx current
+  double m_standbyCurrentA;   //!< The standby current
+  double m_sleepCurrentA;     //!< The sleep current
+  Ptr<SigfoxTxCurrentModel> m_txCurrentModel; //!< The tx current model, if any
+  Time m_checkInterval;       //!< The time between two depletion checks
+  EventId m_checkEvent;       //!< The next depletion check
+
+  // Per device state, one entry per device
+  std::vector<double> m_remainingJ;     //!< The energy left
+  std::vector<double> m_consumed;       //!< The charge drawn by the radio
+  std::vector<double> m_currentA;       //!< The current being drawn
+  std::vector<double> m_lastUpdateS;    //!< The time of the last update, in seconds
+  std::vector<uint8_t> m_state;         //!< The radio state
+  std::vector<uint8_t> m_depleted;      //!< Whether the battery is depleted
+  std::vector<Callback<void> > m_depletionCallbacks; //!< Called on depletion
+};
+
+/**
+ * \ingroup energy
+ *
+ * The DeviceEnergyModel of a device whose battery is kept by a
+ * FleetEnergyLedger.
+ *
+ * The model listens to an EndPointSigfoxPhy and forwards its state changes
+ * to the ledger, and has no state of its own. It is not attached to an
+ * EnergySource: the ledger plays that role.
+ */
+class LedgerRadioEnergyModel : public DeviceEnergyModel, public EndPointSigfoxPhyListener
+{
+public:
+  static TypeId GetTypeId (void);
+
+  LedgerRadioEnergyModel ();
+  virtual ~LedgerRadioEnergyModel ();
+
+  /**
+   * Add the device to a ledger, and start listening to its PHY.
+   *
+   * \param ledger The ledger keeping the battery of the device.
+   * \param phy The PHY of the device.
+   */
+  void Attach (Ptr<FleetEnergyLedger> ledger, Ptr<EndPointSigfoxPhy> phy);
+
+  /**
+   * \return The ledger keeping the battery of the device.
+   */
+  Ptr<FleetEnergyLedger> GetLedger (void) const;
+
+  /**
+   * \return The index of the device in the ledger.
+   */
+  uint32_t GetIndex (void) const;
+
+  /**
+   * \param callback Called when the battery of the device is depleted.
+   */
+  void SetEnergyDepletionCallback (Callback<void> callback);
+
+  // Implementation of DeviceEnergyModel's pure virtual functions
+  virtual void SetEnergySource (Ptr<EnergySource> source);
+  virtual double GetTotalEnergyConsumption (void) const;
+  virtual void ChangeState (int newState);
+  virtual void HandleEnergyDepletion (void);
+  virtual void HandleEnergyRecharged (void);
+  virtual void HandleEnergyChanged (void);
+
+  // Implementation of EndPointSigfoxPhyListener's pure virtual functions
+  virtual void NotifyRxStart (void);
+  virtual void NotifyTxStart (double txPowerDbm);
+  virtual void NotifySleep (void);
+  virtual void NotifyStandby (void);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  virtual double DoGetCurrentA (void) const;
+
+  /**
+   * Forward a state change of the PHY to the ledger. While an analytical
+   * PHY timeline is running, the device draws its average current.
+   *
+   * \param state The new state.
+   * \param txPowerDbm The nominal tx power, only used if state is TX.
+   */
+  void Notify (EndPointSigfoxPhy::State state, double txPowerDbm);
+
+  Ptr<FleetEnergyLedger> m_ledger;  //!< The ledger keeping the battery
+  uint32_t m_index;                 //!< The index of the device in the ledger
+  Ptr<EndPointSigfoxPhy> m_phy;     //!< The PHY we listen to
+  Callback<void> m_energyDepletionCallback; //!< Called on depletion
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* FLEET_ENERGY_LEDGER_H */
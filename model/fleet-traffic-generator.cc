@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/fleet-traffic-generator.h"
+#include "ns3/periodic-sender.h"
+#include "ns3/simulator.h"
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("FleetTrafficGenerator");
+
+NS_OBJECT_ENSURE_REGISTERED (FleetTrafficGenerator);
+
+TypeId
+FleetTrafficGenerator::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::FleetTrafficGenerator")
+    .SetParent<Object> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<FleetTrafficGenerator> ()
+    .AddAttribute ("Resolution",
+                   "The width of the buckets send times are grouped in",
+                   TimeValue (MilliSeconds (10)),
+                   MakeTimeAccessor (&FleetTrafficGenerator::m_resolution),
+                   MakeTimeChecker (NanoSeconds (1)))
+  ;
+  return tid;
+}
+
+FleetTrafficGenerator::FleetTrafficGenerator ()
+  : m_resolution (MilliSeconds (10)),
+    m_nActive (0),
+    m_eventBucket (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+FleetTrafficGenerator::~FleetTrafficGenerator ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+FleetTrafficGenerator::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_event.Cancel ();
+  m_calendar.clear ();
+  m_senders.clear ();
+  m_senderIndex.clear ();
+  Object::DoDispose ();
+}
+
+void
+FleetTrafficGenerator::AddSender (Ptr<PeriodicSender> sender, Time delay)
+{
+  NS_LOG_FUNCTION (this << sender << delay);
+
+  std::map<PeriodicSender *, uint32_t>::iterator it = m_senderIndex.find (PeekPointer (sender));
+  if (it == m_senderIndex.end ())
+    {
+      Sender s;
+      s.app = sender;
+      s.generation = 0;
+      s.active = false;
+      it = m_senderIndex.insert (std::make_pair (PeekPointer (sender), m_senders.size ())).first;
+      m_senders.push_back (s);
+    }
+
+  Sender &s = m_senders[it->second];
+  NS_ABORT_MSG_IF (s.active, "Sender added twice");
+  s.active = true;
+  m_nActive++;
+
+  Entry entry;
+  entry.sender = it->second;
+  entry.generation = s.generation;
+  Insert (entry, Simulator::Now () + delay);
+  ScheduleNextBucket ();
+}
+
+void
+FleetTrafficGenerator::RemoveSender (Ptr<PeriodicSender> sender)
+{
+  NS_LOG_FUNCTION (this << sender);
+
+  std::map<PeriodicSender *, uint32_t>::iterator it = m_senderIndex.find (PeekPointer (sender));
+  if (it == m_senderIndex.end () || !m_senders[it->second].active)
+    {
+      return;
+    }
+
+  // The pending entry is left in the calendar, and skipped because of its
+  // old generation
+  Sender &s = m_senders[it->second];
+  s.active = false;
+  s.generation++;
+  m_nActive--;
+}
+
+uint32_t
+FleetTrafficGenerator::GetNSenders (void) const
+{
+  return m_nActive;
+}
+
+void
+FleetTrafficGenerator::Insert (Entry entry, Time time)
+{
+  // Round up, so that no send happens earlier than requested
+  int64_t width = m_resolution.GetTimeStep ();
+  int64_t bucket = (time.GetTimeStep () + width - 1) / width;
+  m_calendar[bucket].push_back (entry);
+}
+
+void
+FleetTrafficGenerator::ScheduleNextBucket (void)
+{
+  if (m_calendar.empty ())
+    {
+      return;
+    }
+
+  int64_t bucket = m_calendar.begin ()->first;
+  if (m_event.IsRunning () && m_eventBucket == bucket)
+    {
+      return;
+    }
+
+  m_event.Cancel ();
+  m_eventBucket = bucket;
+  Time at = TimeStep (bucket * m_resolution.GetTimeStep ());
+  m_event = Simulator::Schedule (at - Simulator::Now (), &FleetTrafficGenerator::ProcessBucket, this);
+}
+
+void
+FleetTrafficGenerator::ProcessBucket (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  // Take the bucket out first: senders with a very short interval are filed
+  // again while we go through it
+  std::vector<Entry> due;
+  due.swap (m_calendar.begin ()->second);
+  m_calendar.erase (m_calendar.begin ());
+
+  NS_LOG_DEBUG (due.size () << " senders due");
+
+  for (std::vector<Entry>::iterator e = due.begin (); e != due.end (); e++)
+    {
+      Sender &s = m_senders[e->sender];
+      if (!s.active || s.generation != e->generation)
+        {
+          continue;
+        }
+
+      // The interval may change when sending, e.g., with the weather
+      s.app->SendPacket ();
+      Insert (*e, Simulator::Now () + s.app->GetInterval ());
+    }
+
+  ScheduleNextBucket ();
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef FLEET_TRAFFIC_GENERATOR_H
+#define FLEET_TRAFFIC_GENERATOR_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include <map>
+#include <vector>
+
+namespace ns3 {
+namespace sigfox {
+
+class PeriodicSender;
+
+/**
+ * Drive the SendPacket events of many PeriodicSender applications with a
+ * single simulator event.
+ *
+ * Send times are kept in a calendar of buckets of one Resolution each, and
+ * only the earliest non-empty bucket has an event in the simulator: when it
+ * fires, every sender in the bucket sends, and is filed again in the bucket
+ * of its next send according to its current interval. With large fleets,
+ * this keeps the simulator's event queue small no matter how many devices
+ * are simulated.
+ *
+ * Send times are rounded up to the next multiple of the Resolution.
+ */
+class FleetTrafficGenerator : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  FleetTrafficGenerator ();
+  virtual ~FleetTrafficGenerator ();
+
+  /**
+   * Start driving a sender.
+   *
+   * \param sender The application.
+   * \param delay The time until its first send.
+   */
+  void AddSender (Ptr<PeriodicSender> sender, Time delay);
+
+  /**
+   * Stop driving a sender. Its pending send is discarded.
+   *
+   * \param sender The application.
+   */
+  void RemoveSender (Ptr<PeriodicSender> sender);
+
+  /**
+   * Get the number of senders that are being driven.
+   */
+  uint32_t GetNSenders (void) const;
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * A pending send.
+   */
+  struct Entry
+  {
+    uint32_t sender;     //!< The index of the sender in m_senders
+    uint32_t generation; //!< The generation of the sender when it was filed
+  };
+
+  /**
+   * A sender that was added to this generator.
+   */
+  struct Sender
+  {
+    Ptr<PeriodicSender> app; //!< The application
+    uint32_t generation;     //!< Incremented when the sender is removed
+    bool active;             //!< Whether the sender is being driven
+  };
+
+  /**
+   * File a sender in the bucket of a given time.
+   *
+   * \param entry The sender.
+   * \param time The time of the send.
+   */
+  void Insert (Entry entry, Time time);
+
+  /**
+   * Make sure the simulator event is set for the earliest bucket.
+   */
+  void ScheduleNextBucket (void);
+
+  /**
+   * Have all senders in the earliest bucket send.
+   */
+  void ProcessBucket (void);
+
+  Time m_resolution;                    //!< The width of a bucket
+
+  std::vector<Sender> m_senders;        //!< The senders, by index
+  std::map<PeriodicSender *, uint32_t> m_senderIndex; //!< The index of each sender
+  uint32_t m_nActive;                   //!< The number of senders being driven
+
+  std::map<int64_t, std::vector<Entry> > m_calendar; //!< The pending sends, by bucket
+
+  EventId m_event;                      //!< The event of the earliest bucket
+  int64_t m_eventBucket;                //!< The bucket m_event is for
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* FLEET_TRAFFIC_GENERATOR_H */
@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/frequency-hopping-sequence.h"
+#include "ns3/logical-sigfox-channel-helper.h"
+#include "ns3/uinteger.h"
+#include "ns3/enum.h"
+#include "ns3/log.h"
+#include "ns3/abort.h"
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("FrequencyHoppingSequence");
+
+NS_OBJECT_ENSURE_REGISTERED (FrequencyHoppingSequence);
+
+namespace {
+
+// Multipliers and key increments of Philox4x32, see Salmon et al.,
+// "Parallel random numbers: as easy as 1, 2, 3", SC 2011.
+const uint32_t PHILOX_M0 = 0xD2511F53;
+const uint32_t PHILOX_M1 = 0xCD9E8D57;
+const uint32_t PHILOX_W0 = 0x9E3779B9;
+const uint32_t PHILOX_W1 = 0xBB67AE85;
+
+inline void
+PhiloxRound (uint32_t ctr[4], const uint32_t key[2])
+{
+  uint64_t p0 = static_cast<uint64_t> (PHILOX_M0) * ctr[0];
+  uint64_t p1 = static_cast<uint64_t> (PHILOX_M1) * ctr[2];
+  uint32_t hi0 = p0 >> 32;
+  uint32_t lo0 = static_cast<uint32_t> (p0);
+  uint32_t hi1 = p1 >> 32;
+  uint32_t lo1 = static_cast<uint32_t> (p1);
+
+  uint32_t c1 = ctr[1];
+  uint32_t c3 = ctr[3];
+  ctr[0] = hi1 ^ c1 ^ key[0];
+  ctr[1] = lo1;
+  ctr[2] = hi0 ^ c3 ^ key[1];
+  ctr[3] = lo0;
+}
+
+// Philox4x32-10: ten rounds, bumping the key between them
+inline void
+Philox4x32 (uint32_t ctr[4], uint64_t seed)
+{
+  uint32_t key[2] = {static_cast<uint32_t> (seed), static_cast<uint32_t> (seed >> 32)};
+  for (int round = 0; round < 10; round++)
+    {
+      if (round > 0)
+        {
+          key[0] += PHILOX_W0;
+          key[1] += PHILOX_W1;
+        }
+      PhiloxRound (ctr, key);
+    }
+}
+
+} // anonymous namespace
+
+TypeId
+FrequencyHoppingSequence::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::FrequencyHoppingSequence")
+    .SetParent<Object> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<FrequencyHoppingSequence> ()
+    .AddAttribute ("Seed",
+                   "The key of the generator: sequences obtained with "
+                   "different seeds are independent",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&FrequencyHoppingSequence::m_seed),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("Policy",
+                   "How the channels of the repetitions of a message are chosen",
+                   EnumValue (FrequencyHoppingSequence::INDEPENDENT),
+                   MakeEnumAccessor (&FrequencyHoppingSequence::m_policy),
+                   MakeEnumChecker (FrequencyHoppingSequence::INDEPENDENT, "Independent",
+                                    FrequencyHoppingSequence::PARTITIONED, "Partitioned",
+                                    FrequencyHoppingSequence::FIXED_OFFSET, "FixedOffset"))
+    .AddAttribute ("NumberOfPartitions",
+                   "Number of parts the channel set is split in by the "
+                   "Partitioned policy",
+                   UintegerValue (3),
+                   MakeUintegerAccessor (&FrequencyHoppingSequence::m_nPartitions),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("ChannelOffset",
+                   "Distance, in channels, between consecutive repetitions "
+                   "with the FixedOffset policy",
+                   UintegerValue (120),
+                   MakeUintegerAccessor (&FrequencyHoppingSequence::m_channelOffset),
+                   MakeUintegerChecker<uint32_t> ());
+  return tid;
+}
+
+FrequencyHoppingSequence::FrequencyHoppingSequence () :
+  m_seed (1),
+  m_policy (INDEPENDENT),
+  m_nPartitions (3),
+  m_channelOffset (120)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+FrequencyHoppingSequence::~FrequencyHoppingSequence ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint32_t
+FrequencyHoppingSequence::Draw (uint32_t deviceId, uint32_t messageNumber,
+                                uint32_t repetition, uint32_t n) const
+{
+  uint32_t ctr[4] = {deviceId, messageNumber, repetition, 0};
+  Philox4x32 (ctr, m_seed);
+
+  // Map 64 random bits to [0, n): the bias is negligible for the small
+  // ranges we deal with
+  uint64_t value = (static_cast<uint64_t> (ctr[0]) << 32) | ctr[1];
+  return value % n;
+}
+
+uint32_t
+FrequencyHoppingSequence::GetChannel (uint32_t deviceId, uint32_t messageNumber,
+                                      uint32_t repetition) const
+{
+  NS_LOG_FUNCTION (this << deviceId << messageNumber << repetition);
+
+  uint32_t nChannels = LogicalSigfoxChannelHelper::nUplinkChannels;
+
+  uint32_t channel = 0;
+  switch (m_policy)
+    {
+    case INDEPENDENT:
+      channel = Draw (deviceId, messageNumber, repetition, nChannels);
+      break;
+    case PARTITIONED:
+      {
+        NS_ABORT_MSG_IF (m_nPartitions > nChannels, "NumberOfPartitions is " << m_nPartitions <<
+                         " but there are only " << nChannels << " channels");
+        uint32_t partitionSize = nChannels / m_nPartitions;
+        uint32_t partition = repetition % m_nPartitions;
+        channel = partition * partitionSize +
+          Draw (deviceId, messageNumber, repetition, partitionSize);
+        break;
+      }
+    case FIXED_OFFSET:
+      channel = (Draw (deviceId, messageNumber, 0, nChannels) +
+                 static_cast<uint64_t> (repetition) * m_channelOffset) % nChannels;
+      break;
+    }
+
+  NS_LOG_DEBUG ("Device " << deviceId << ", message " << messageNumber <<
+                ", repetition " << repetition << ": channel " << channel);
+
+  return channel;
+}
+
+double
+FrequencyHoppingSequence::GetFrequency (uint32_t deviceId, uint32_t messageNumber,
+                                        uint32_t repetition,
+                                        enum SigfoxRadioConfiguration rc) const
+{
+  return LogicalSigfoxChannelHelper::GetFrequencyFromChannelNumber
+           (GetChannel (deviceId, messageNumber, repetition), rc);
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef FREQUENCY_HOPPING_SEQUENCE_H
+#define FREQUENCY_HOPPING_SEQUENCE_H
+
+#include "ns3/object.h"
+#include "ns3/sigfox-radio-configuration.h"
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * Deterministic frequency hopping pattern for the repetitions of uplink
+ * messages.
+ *
+ * The channel used by a repetition is a pure function of the device, the
+ * message number and the repetition number, computed with a counter-based
+ * pseudo random number generator (Philox4x32-10). A single instance can
+ * therefore be shared by all the devices in a simulation: no generator
+ * state needs to be kept per device, and any repetition of any message can
+ * be looked up in constant time, in any order.
+ *
+ * Different hopping policies are available, to study how they affect the
+ * collision rate:
+ * - INDEPENDENT: each repetition uses a channel drawn uniformly from the
+ *   whole channel set;
+ * - PARTITIONED: the channel set is split in NumberOfPartitions contiguous
+ *   parts, and repetition r uses a uniformly drawn channel in part
+ *   r % NumberOfPartitions;
+ * - FIXED_OFFSET: the first repetition uses a uniformly drawn channel, and
+ *   each following repetition is ChannelOffset channels above the previous
+ *   one (wrapping around the channel set).
+ */
+class FrequencyHoppingSequence : public Object
+{
+public:
+  /**
+   * The available hopping policies.
+   */
+  enum Policy
+  {
+    INDEPENDENT,
+    PARTITIONED,
+    FIXED_OFFSET
+  };
+
+  static TypeId GetTypeId (void);
+
+  FrequencyHoppingSequence ();
+  virtual ~FrequencyHoppingSequence ();
+
+  /**
+   * Get the channel a repetition should be sent on.
+   *
+   * \param deviceId The identifier of the sending device.
+   * \param messageNumber The number of the message, as counted by the device.
+   * \param repetition The repetition number within the message.
+   * \return The channel number, between 0 and LogicalSigfoxChannelHelper's
+   * number of uplink channels (excluded).
+   */
+  uint32_t GetChannel (uint32_t deviceId, uint32_t messageNumber,
+                       uint32_t repetition) const;
+
+  /**
+   * Get the frequency a repetition should be sent on.
+   *
+   * \param deviceId The identifier of the sending device.
+   * \param messageNumber The number of the message, as counted by the device.
+   * \param repetition The repetition number within the message.
+   * \param rc The radio configuration of the uplink channel set.
+   * \return The center frequency of the channel, in Hz.
+   */
+  double GetFrequency (uint32_t deviceId, uint32_t messageNumber,
+                       uint32_t repetition, enum SigfoxRadioConfiguration rc = RC1) const;
+
+private:
+  /**
+   * Draw a uniformly distributed integer in [0, n).
+   *
+   * \param deviceId The first word of the counter.
+   * \param messageNumber The second word of the counter.
+   * \param repetition The third word of the counter.
+   * \param n The size of the range.
+   */
+  uint32_t Draw (uint32_t deviceId, uint32_t messageNumber, uint32_t repetition,
+                 uint32_t n) const;
+
+  uint64_t m_seed; //!< The key of the counter-based generator
+
+  Policy m_policy; //!< The hopping policy
+
+  uint32_t m_nPartitions; //!< Number of parts used by the PARTITIONED policy
+
+  uint32_t m_channelOffset; //!< The offset used by the FIXED_OFFSET policy
+};
+
+} // namespace sigfox
+} // namespace ns3
+
+#endif /* FREQUENCY_HOPPING_SEQUENCE_H */
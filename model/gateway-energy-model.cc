@@ -0,0 +1,191 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/gateway-energy-model.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("GatewayEnergyModel");
+
+NS_OBJECT_ENSURE_REGISTERED (GatewayEnergyModel);
+
+TypeId
+GatewayEnergyModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::GatewayEnergyModel")
+    .SetParent<DeviceEnergyModel> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<GatewayEnergyModel> ()
+    .AddAttribute ("BasePowerW",
+                   "The power drawn all the time by the gateway and its backhaul",
+                   DoubleValue (15),
+                   MakeDoubleAccessor (&GatewayEnergyModel::m_basePowerW),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("DemodulationPowerW",
+                   "The power drawn for each message being demodulated",
+                   DoubleValue (0.1),
+                   MakeDoubleAccessor (&GatewayEnergyModel::m_demodulationPowerW),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("TxPowerW",
+                   "The power drawn while transmitting a downlink, on top of "
+                   "the base power",
+                   DoubleValue (20),
+                   MakeDoubleAccessor (&GatewayEnergyModel::m_txPowerW),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("BackhaulEnergyPerMessageJ",
+                   "The energy to forward a message received correctly to "
+                   "the network",
+                   DoubleValue (0.5),
+                   MakeDoubleAccessor (&GatewayEnergyModel::m_backhaulEnergyJ),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("SupplyVoltageV",
+                   "The voltage the current drawn from an energy source is "
+                   "computed at",
+                   DoubleValue (48),
+                   MakeDoubleAccessor (&GatewayEnergyModel::m_supplyVoltageV),
+                   MakeDoubleChecker<double> (0))
+  ;
+  return tid;
+}
+
+GatewayEnergyModel::GatewayEnergyModel ()
+  : m_startReceptionCount (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+GatewayEnergyModel::~GatewayEnergyModel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+GatewayEnergyModel::SetPhy (Ptr<GatewaySigfoxPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  NS_ASSERT (phy != 0);
+
+  m_phy = phy;
+  m_startTime = Simulator::Now ();
+  m_startReceptionCount = phy->GetReceptionCount ();
+  m_startReceptionTime = phy->GetReceptionTime ();
+  m_startTransmissionTime = phy->GetTransmissionTime ();
+}
+
+Ptr<GatewaySigfoxPhy>
+GatewayEnergyModel::GetPhy (void) const
+{
+  return m_phy;
+}
+
+double
+GatewayEnergyModel::GetAveragePowerW (void) const
+{
+  double seconds = (Simulator::Now () - m_startTime).GetSeconds ();
+  if (seconds <= 0)
+    {
+      return m_basePowerW;
+    }
+  return GetTotalEnergyConsumption () / seconds;
+}
+
+uint64_t
+GatewayEnergyModel::GetReceptionCount (void) const
+{
+  return m_phy != 0 ? m_phy->GetReceptionCount () - m_startReceptionCount : 0;
+}
+
+Time
+GatewayEnergyModel::GetReceptionTime (void) const
+{
+  return m_phy != 0 ? m_phy->GetReceptionTime () - m_startReceptionTime : Seconds (0);
+}
+
+Time
+GatewayEnergyModel::GetTransmissionTime (void) const
+{
+  return m_phy != 0 ? m_phy->GetTransmissionTime () - m_startTransmissionTime : Seconds (0);
+}
+
+void
+GatewayEnergyModel::SetEnergySource (Ptr<EnergySource> source)
+{
+  NS_LOG_FUNCTION (this << source);
+  m_source = source;
+}
+
+double
+GatewayEnergyModel::GetTotalEnergyConsumption (void) const
+{
+  if (m_phy == 0)
+    {
+      return 0;
+    }
+
+  double energyJ = m_basePowerW * (Simulator::Now () - m_startTime).GetSeconds ();
+  energyJ += m_demodulationPowerW * GetReceptionTime ().GetSeconds ();
+  energyJ += m_txPowerW * GetTransmissionTime ().GetSeconds ();
+  energyJ += m_backhaulEnergyJ * GetReceptionCount ();
+  return energyJ;
+}
+
+void
+GatewayEnergyModel::ChangeState (int newState)
+{
+  // The state of the gateway is read from its PHY
+}
+
+void
+GatewayEnergyModel::HandleEnergyDepletion (void)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+GatewayEnergyModel::HandleEnergyRecharged (void)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+GatewayEnergyModel::HandleEnergyChanged (void)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+GatewayEnergyModel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_source = 0;
+  // m_phy is kept, so that the consumption can still be reported while the
+  // simulation is destroyed
+}
+
+double
+GatewayEnergyModel::DoGetCurrentA (void) const
+{
+  return GetAveragePowerW () / m_supplyVoltageV;
+}
+
+} // namespace sigfox
+} // namespace ns3
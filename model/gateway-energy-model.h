@@ -0,0 +1,118 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef GATEWAY_ENERGY_MODEL_H
+#define GATEWAY_ENERGY_MODEL_H
+
+#include "ns3/device-energy-model.h"
+#include "ns3/energy-source.h"
+#include "ns3/gateway-sigfox-phy.h"
+#include "ns3/nstime.h"
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * \ingroup energy
+ *
+ * The power drawn by a gateway and its backhaul.
+ *
+ * The gateway draws BasePowerW all the time, plus DemodulationPowerW for
+ * each message being demodulated, TxPowerW while it transmits a downlink,
+ * and BackhaulEnergyPerMessageJ for each message it receives correctly and
+ * forwards to the network. The energy is computed from the counters of the
+ * gateway PHY whenever it is asked for, so the model schedules no events and
+ * does nothing per message.
+ *
+ * Gateways are usually mains powered, so the model does not need an energy
+ * source. If one is set, the model draws its average current since it was
+ * installed.
+ */
+class GatewayEnergyModel : public DeviceEnergyModel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  GatewayEnergyModel ();
+  virtual ~GatewayEnergyModel ();
+
+  /**
+   * Start accounting for the activity of a gateway PHY from now on.
+   *
+   * \param phy The PHY of the gateway.
+   */
+  void SetPhy (Ptr<GatewaySigfoxPhy> phy);
+
+  /**
+   * \return The PHY of the gateway.
+   */
+  Ptr<GatewaySigfoxPhy> GetPhy (void) const;
+
+  /**
+   * \return The power drawn on average since the PHY was set, in Watts.
+   */
+  double GetAveragePowerW (void) const;
+
+  /**
+   * \return The number of messages received correctly since the PHY was set.
+   */
+  uint64_t GetReceptionCount (void) const;
+
+  /**
+   * \return The time spent demodulating since the PHY was set.
+   */
+  Time GetReceptionTime (void) const;
+
+  /**
+   * \return The time spent transmitting since the PHY was set.
+   */
+  Time GetTransmissionTime (void) const;
+
+  // Implementation of DeviceEnergyModel's pure virtual functions
+  virtual void SetEnergySource (Ptr<EnergySource> source);
+  virtual double GetTotalEnergyConsumption (void) const;
+  virtual void ChangeState (int newState);
+  virtual void HandleEnergyDepletion (void);
+  virtual void HandleEnergyRecharged (void);
+  virtual void HandleEnergyChanged (void);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  virtual double DoGetCurrentA (void) const;
+
+  Ptr<EnergySource> m_source;        //!< The energy source, if any
+  Ptr<GatewaySigfoxPhy> m_phy;       //!< The PHY of the gateway
+
+  double m_basePowerW;               //!< The power drawn all the time
+  double m_demodulationPowerW;       //!< The power drawn per message being demodulated
+  double m_txPowerW;                 //!< The power drawn while transmitting
+  double m_backhaulEnergyJ;          //!< The energy to forward a message
+  double m_supplyVoltageV;           //!< The voltage the current is computed at
+
+  Time m_startTime;                  //!< When the PHY was set
+  uint64_t m_startReceptionCount;    //!< The reception count of the PHY then
+  Time m_startReceptionTime;         //!< The reception time of the PHY then
+  Time m_startTransmissionTime;      //!< The transmission time of the PHY then
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* GATEWAY_ENERGY_MODEL_H */
@@ -22,7 +22,10 @@
 #include "ns3/gateway-sigfox-mac.h"
 #include "ns3/sigfox-mac-header.h"
 #include "ns3/sigfox-net-device.h"
+#include "ns3/downlink-scheduler.h"
+#include "ns3/simulator.h"
 #include "ns3/log.h"
+#include <algorithm>
 
 namespace ns3 {
 namespace sigfox {
@@ -41,9 +44,13 @@ GatewaySigfoxMac::GetTypeId (void)
   return tid;
 }
 
-GatewaySigfoxMac::GatewaySigfoxMac ()
+GatewaySigfoxMac::GatewaySigfoxMac () :
+  m_busyUntil (Seconds (0))
 {
   NS_LOG_FUNCTION (this);
+
+  // The daily message quota only applies to end points
+  m_channelHelper->SetDailyMessageQuota (0);
 }
 
 GatewaySigfoxMac::~GatewaySigfoxMac ()
@@ -51,41 +58,108 @@ GatewaySigfoxMac::~GatewaySigfoxMac ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+GatewaySigfoxMac::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_downlinkScheduler = 0;
+  SigfoxMac::DoDispose ();
+}
+
 void
 GatewaySigfoxMac::Send (Ptr<Packet> packet)
 {
   NS_LOG_FUNCTION (this << packet);
 
-  // Get DataRate to send this packet with
-  SigfoxTag tag;
-  packet->RemovePacketTag (tag);
-  double frequency = tag.GetFrequency ();
-  NS_LOG_DEBUG ("Freq: " << frequency << " MHz");
-  packet->AddPacketTag (tag);
+  // Verify we are respecting Duty Cycle
+  if (GetDownlinkAvailableTime (packet) > Simulator::Now ())
+    {
+      NS_LOG_INFO ("Cannot send downlink because of duty cycle");
+      m_cannotSendBecauseDutyCycle (packet);
+      return;
+    }
 
-  // XXX Verify we are respecting Duty Cycle
+  ScheduleDownlink (packet, Seconds (0));
+}
 
+SigfoxTxParameters
+GatewaySigfoxMac::GetDownlinkTxParameters (void)
+{
   SigfoxTxParameters params;
+  params.rc = m_channelHelper->GetRadioConfiguration ();
   params.bandwidthHz = 600;
   params.nPreamble = 223;
+  params.downlink = true;
+
+  return params;
+}
+
+Time
+GatewaySigfoxMac::GetDownlinkAvailableTime (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+
+  SigfoxTag tag;
+  packet->PeekPacketTag (tag);
+
+  Time duration = m_phy->GetOnAirTime (packet, GetDownlinkTxParameters ());
+  Time waitingTime = m_channelHelper->GetTransmissionWaitingTime (duration,
+                                                                  tag.GetFrequency ());
+  if (waitingTime == Time::Max ())
+    {
+      return Time::Max ();
+    }
+
+  return std::max (Simulator::Now () + waitingTime, m_busyUntil);
+}
+
+void
+GatewaySigfoxMac::ScheduleDownlink (Ptr<Packet> packet, Time delay)
+{
+  NS_LOG_FUNCTION (this << packet << delay);
+
+  SigfoxTag tag;
+  packet->PeekPacketTag (tag);
+  double frequency = tag.GetFrequency ();
+  NS_LOG_DEBUG ("Freq: " << frequency << " Hz");
 
   // Get the duration
-  Time duration = m_phy->GetOnAirTime (packet, params);
+  Time duration = m_phy->GetOnAirTime (packet, GetDownlinkTxParameters ());
 
   NS_LOG_DEBUG ("Duration: " << duration.GetSeconds ());
 
-  // Find the channel with the desired frequency
-  double sendingPower = m_channelHelper.GetTxPowerForFrequency (frequency);
-
   // Add the event to the channelHelper to keep track of duty cycle
-  m_channelHelper.AddEvent (duration, frequency);
+  m_channelHelper->AddEvent (duration, frequency);
+  m_busyUntil = std::max (m_busyUntil, Simulator::Now () + delay + duration);
+
+  Simulator::Schedule (delay, &GatewaySigfoxMac::DoSendDownlink, this, packet);
+}
+
+void
+GatewaySigfoxMac::DoSendDownlink (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+
+  SigfoxTag tag;
+  packet->PeekPacketTag (tag);
+  double frequency = tag.GetFrequency ();
+
+  // Find the channel with the desired frequency
+  double sendingPower = m_channelHelper->GetTxPowerForFrequency (frequency);
 
   // Send the packet to the PHY layer to send it on the channel
-  m_phy->Send (packet, params, frequency, sendingPower);
+  m_phy->Send (packet, GetDownlinkTxParameters (), frequency, sendingPower);
 
   m_sentNewPacket (packet);
 }
 
+void
+GatewaySigfoxMac::SetDownlinkScheduler (Ptr<DownlinkScheduler> scheduler)
+{
+  m_downlinkScheduler = scheduler;
+}
+
 bool
 GatewaySigfoxMac::IsTransmitting (void)
 {
@@ -111,6 +185,11 @@ GatewaySigfoxMac::Receive (Ptr<Packet const> packet)
       NS_LOG_DEBUG ("Received packet: " << packet);
 
       m_receivedPacket (packet);
+
+      if (m_downlinkScheduler)
+        {
+          m_downlinkScheduler->NotifyUplink (this, packet);
+        }
     }
   else
     {
@@ -135,7 +214,7 @@ GatewaySigfoxMac::GetWaitingTime (double frequency)
 {
   NS_LOG_FUNCTION_NOARGS ();
 
-  return m_channelHelper.GetWaitingTime (frequency);
+  return m_channelHelper->GetWaitingTime (frequency);
 }
 
 void GatewaySigfoxMac::BDPFrequency(int x)
@@ -30,6 +30,8 @@
 namespace ns3 {
 namespace sigfox {
 
+class DownlinkScheduler;
+
 class GatewaySigfoxMac : public SigfoxMac
 {
 public:
@@ -59,8 +61,58 @@ public:
    * \return The next transmission time.
    */
   Time GetWaitingTime (double frequency);
-private:
+
+  /**
+   * Get the earliest time at which this gateway could start sending a
+   * downlink packet, taking into account the duty cycle of the downlink
+   * SubBand and the downlinks that are already scheduled.
+   *
+   * \param packet The packet, tagged with the downlink frequency.
+   * \return The earliest transmission time.
+   */
+  Time GetDownlinkAvailableTime (Ptr<Packet> packet);
+
+  /**
+   * Send a downlink packet after a delay. The airtime is accounted for right
+   * away, so that following calls to GetDownlinkAvailableTime see it.
+   *
+   * \param packet The packet, tagged with the downlink frequency.
+   * \param delay The time to wait before sending.
+   */
+  void ScheduleDownlink (Ptr<Packet> packet, Time delay);
+
+  /**
+   * Report the uplink packets this gateway receives to a DownlinkScheduler.
+   *
+   * \param scheduler The scheduler.
+   */
+  void SetDownlinkScheduler (Ptr<DownlinkScheduler> scheduler);
+
 protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * Build the parameters used for downlink transmissions.
+   */
+  SigfoxTxParameters GetDownlinkTxParameters (void);
+
+  /**
+   * Hand a downlink packet to the PHY.
+   *
+   * \param packet The packet, tagged with the downlink frequency.
+   */
+  void DoSendDownlink (Ptr<Packet> packet);
+
+  /**
+   * The scheduler uplinks are reported to, if any.
+   */
+  Ptr<DownlinkScheduler> m_downlinkScheduler;
+
+  /**
+   * The end of the last downlink that was scheduled.
+   */
+  Time m_busyUntil;
 };
 
 } /* namespace ns3 */
@@ -58,7 +58,11 @@ GatewaySigfoxPhy::GetTypeId (void)
 }
 
 GatewaySigfoxPhy::GatewaySigfoxPhy () :
-  m_isTransmitting (false)
+  m_isTransmitting (false),
+  m_receptionCount (0),
+  m_receptionTime (Seconds (0)),
+  m_transmissionTime (Seconds (0)),
+  m_transmissionEnd (Seconds (0))
 {
   NS_LOG_FUNCTION_NOARGS ();
 }
@@ -84,10 +88,33 @@ GatewaySigfoxPhy::IsTransmitting (void)
   return m_isTransmitting;
 }
 
+uint64_t
+GatewaySigfoxPhy::GetReceptionCount (void) const
+{
+  return m_receptionCount;
+}
+
+Time
+GatewaySigfoxPhy::GetReceptionTime (void) const
+{
+  return m_receptionTime;
+}
+
+Time
+GatewaySigfoxPhy::GetTransmissionTime (void) const
+{
+  // The last transmission is counted in full as soon as it starts
+  if (m_transmissionEnd > Simulator::Now ())
+    {
+      return m_transmissionTime - (m_transmissionEnd - Simulator::Now ());
+    }
+  return m_transmissionTime;
+}
+
 bool
-GatewaySigfoxPhy::IsOnFrequency (double frequencyMHz)
+GatewaySigfoxPhy::IsOnFrequency (double frequencyHz)
 {
-  NS_LOG_FUNCTION (this << frequencyMHz);
+  NS_LOG_FUNCTION (this << frequencyHz);
 
   return true;
 }
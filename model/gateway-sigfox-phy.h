@@ -53,19 +53,37 @@ public:
   GatewaySigfoxPhy ();
   virtual ~GatewaySigfoxPhy ();
 
-  virtual void StartReceive (Ptr<Packet> packet, double rxPowerDbm, Time duration, double frequencyMHz) = 0;
+  virtual void StartReceive (Ptr<Packet> packet, double rxPowerDbm, Time duration, double frequencyHz) = 0;
 
   virtual void EndReceive (Ptr<Packet> packet,
                            Ptr<SigfoxInterferenceHelper::Event> event) = 0;
 
   virtual void Send (Ptr<Packet> packet, SigfoxTxParameters txParams,
-                     double frequencyMHz, double txPowerDbm) = 0;
+                     double frequencyHz, double txPowerDbm) = 0;
 
   virtual void TxFinished (Ptr<Packet> packet);
 
   bool IsTransmitting (void);
 
-  virtual bool IsOnFrequency (double frequencyMHz);
+  /**
+   * \returns The number of messages received correctly so far.
+   */
+  uint64_t GetReceptionCount (void) const;
+
+  /**
+   * \returns The time spent demodulating messages so far, summed over the
+   * messages received in parallel. Only the receptions that ended are
+   * counted.
+   */
+  Time GetReceptionTime (void) const;
+
+  /**
+   * \returns The time spent transmitting so far, including the current
+   * transmission.
+   */
+  Time GetTransmissionTime (void) const;
+
+  virtual bool IsOnFrequency (double frequencyHz);
 
   /**
    * A vector containing the sensitivities required to correctly decode
@@ -88,9 +106,9 @@ public:
     /**
      * Constructor.
      *
-     * \param frequencyMHz The frequency this path is set to listen on.
+     * \param frequencyHz The frequency this path is set to listen on.
      */
-    ReceptionPath (double frequencyMHz);
+    ReceptionPath (double frequencyHz);
 
     ~ReceptionPath ();
 
@@ -104,9 +122,9 @@ public:
     /**
      * Setter for the frequency.
      *
-     * \param frequencyMHz The frequency [MHz] this ReceptionPath will listen on.
+     * \param frequencyHz The frequency [Hz] this ReceptionPath will listen on.
      */
-    void SetFrequency (double frequencyMHz);
+    void SetFrequency (double frequencyHz);
 
     /**
      * Query whether this reception path is available to lock on a signal.
@@ -160,9 +178,9 @@ public:
 
 private:
     /**
-     * The frequency this path is currently listening on, in MHz.
+     * The frequency this path is currently listening on, in Hz.
      */
-    double m_frequencyMHz;
+    double m_frequencyHz;
 
     /**
      * Whether this reception path is available to lock on a signal or not.
@@ -203,6 +221,11 @@ private:
   TracedCallback<Ptr<const Packet>, uint32_t> m_noReceptionBecauseTransmitting;
 
   bool m_isTransmitting; //!< Flag indicating whether a transmission is going on
+
+  uint64_t m_receptionCount; //!< The number of messages received correctly
+  Time m_receptionTime;      //!< The time spent demodulating ended receptions
+  Time m_transmissionTime;   //!< The time of all transmissions started so far
+  Time m_transmissionEnd;    //!< The end of the last transmission
 };
 
 } /* namespace ns3 */
@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/irradiance-timeline.h"
+#include "ns3/simulator.h"
+#include "ns3/fatal-error.h"
+#include "ns3/log.h"
+#include <cstring>
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("IrradianceTimeline");
+
+std::map<std::string, Ptr<IrradianceTimeline> > &
+IrradianceTimeline::GetTimelines (void)
+{
+  static std::map<std::string, Ptr<IrradianceTimeline> > timelines;
+  return timelines;
+}
+
+Ptr<const IrradianceTimeline>
+IrradianceTimeline::Open (std::string path)
+{
+  NS_LOG_FUNCTION (path);
+
+  std::map<std::string, Ptr<IrradianceTimeline> > &timelines = GetTimelines ();
+  std::map<std::string, Ptr<IrradianceTimeline> >::iterator it = timelines.find (path);
+  if (it != timelines.end ())
+    {
+      return it->second;
+    }
+
+  if (timelines.empty ())
+    {
+      Simulator::ScheduleDestroy (&IrradianceTimeline::Clear);
+    }
+
+  // The constructor is private, so Create<> cannot be used
+  Ptr<IrradianceTimeline> timeline = Ptr<IrradianceTimeline> (new IrradianceTimeline (path), false);
+  timelines[path] = timeline;
+  return timeline;
+}
+
+IrradianceTimeline::IrradianceTimeline (std::string path)
+  : m_file (path),
+    m_nHours (0)
+{
+  NS_LOG_FUNCTION (this << path);
+
+  if (m_file.GetSize () == 0 || m_file.GetSize () % sizeof (float) != 0)
+    {
+      NS_FATAL_ERROR ("Irradiance timeline " << path << " is not an array of 32 bit floats");
+    }
+
+  m_nHours = m_file.GetSize () / sizeof (float);
+  NS_LOG_DEBUG ("Mapped " << m_nHours << " hours from " << path);
+}
+
+IrradianceTimeline::~IrradianceTimeline ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint32_t
+IrradianceTimeline::GetNHours (void) const
+{
+  return m_nHours;
+}
+
+double
+IrradianceTimeline::GetIrradiance (uint64_t hour) const
+{
+  // Assemble the value byte by byte, as in SensorTraceStore
+  const uint8_t *p = m_file.GetData () + (hour % m_nHours) * sizeof (float);
+  uint32_t bits = static_cast<uint32_t> (p[0]) |
+    static_cast<uint32_t> (p[1]) << 8 |
+    static_cast<uint32_t> (p[2]) << 16 |
+    static_cast<uint32_t> (p[3]) << 24;
+  float value;
+  std::memcpy (&value, &bits, sizeof (value));
+  return value;
+}
+
+Time
+IrradianceTimeline::GetStep (void)
+{
+  return Hours (1);
+}
+
+void
+IrradianceTimeline::Clear (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  GetTimelines ().clear ();
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef IRRADIANCE_TIMELINE_H
+#define IRRADIANCE_TIMELINE_H
+
+#include "ns3/simple-ref-count.h"
+#include "ns3/ptr.h"
+#include "ns3/nstime.h"
+#include "ns3/mapped-file.h"
+#include <stdint.h>
+#include <map>
+#include <string>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * A series of hourly solar irradiance values, memory-mapped from a file.
+ *
+ * The file is a plain array of little-endian 32 bit floats, the average
+ * irradiance of each hour in W/m^2, with no header (see
+ * data/irradiance-hourly.bin, a synthetic year). Each file is mapped only
+ * once per simulation and shared by all the energy sources that harvest
+ * from it. The series wraps around, so that a year can be repeated.
+ */
+class IrradianceTimeline : public SimpleRefCount<IrradianceTimeline>
+{
+public:
+  ~IrradianceTimeline ();
+
+  /**
+   * Get the timeline stored in a file, mapping it if it is not mapped yet.
+   *
+   * \param path The path of the file.
+   * \return The timeline, shared by all callers using the same path.
+   */
+  static Ptr<const IrradianceTimeline> Open (std::string path);
+
+  /**
+   * Get the number of hours in the timeline.
+   */
+  uint32_t GetNHours (void) const;
+
+  /**
+   * Get the irradiance of an hour.
+   *
+   * \param hour The index of the hour, wrapping around.
+   * \return The irradiance, in W/m^2.
+   */
+  double GetIrradiance (uint64_t hour) const;
+
+  /**
+   * Get the duration of a value of the timeline.
+   */
+  static Time GetStep (void);
+
+private:
+  /**
+   * Map a file.
+   *
+   * \param path The path of the file.
+   */
+  IrradianceTimeline (std::string path);
+
+  /**
+   * Get the timelines that are mapped, indexed by path.
+   */
+  static std::map<std::string, Ptr<IrradianceTimeline> > &GetTimelines (void);
+
+  /**
+   * Release all timelines. Scheduled to run when the simulation is destroyed.
+   */
+  static void Clear (void);
+
+  MappedFile m_file;  //!< The mapped file
+  uint32_t m_nHours;  //!< The number of hours
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* IRRADIANCE_TIMELINE_H */
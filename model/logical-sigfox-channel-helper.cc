@@ -19,10 +19,10 @@
  */
 
 #include "ns3/logical-sigfox-channel-helper.h"
-#include "ns3/double.h"
 #include "ns3/random-variable-stream.h"
 #include "ns3/simulator.h"
 #include "ns3/log.h"
+#include <algorithm>
 
 namespace ns3 {
 namespace sigfox {
@@ -41,11 +41,16 @@ LogicalSigfoxChannelHelper::GetTypeId (void)
 }
 
 LogicalSigfoxChannelHelper::LogicalSigfoxChannelHelper () :
+  m_dailyMessageQuota (140),
+  m_lastSubBandId (0),
   m_nextAggregatedTransmissionTime (Seconds (0)),
   m_aggregatedDutyCycle (1),
-  m_channelSelector (CreateObject<UniformRandomVariable> ())
+  m_stream (-1)
 {
   NS_LOG_FUNCTION (this);
+
+  m_quotaBucket.tokens = m_dailyMessageQuota;
+  m_quotaBucket.lastUpdate = Seconds (0);
 }
 
 LogicalSigfoxChannelHelper::~LogicalSigfoxChannelHelper ()
@@ -53,52 +58,139 @@ LogicalSigfoxChannelHelper::~LogicalSigfoxChannelHelper ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+LogicalSigfoxChannelHelper::SetChannelPlan (Ptr<SigfoxChannelPlan> plan)
+{
+  NS_LOG_FUNCTION (this << plan);
+
+  m_plan = plan;
+  m_dutyCycleBuckets.clear ();
+  m_lastSubBandId = 0;
+}
+
+Ptr<const SigfoxChannelPlan>
+LogicalSigfoxChannelHelper::GetChannelPlan (void) const
+{
+  return m_plan;
+}
+
+SigfoxChannelPlan &
+LogicalSigfoxChannelHelper::GetPrivatePlan (void)
+{
+  if (m_plan == 0)
+    {
+      m_plan = Create<SigfoxChannelPlan> ();
+    }
+  else if (m_plan->GetReferenceCount () > 1)
+    {
+      // Copy on write, other devices are using this plan
+      NS_LOG_DEBUG ("Copying shared channel plan");
+      m_plan = Create<SigfoxChannelPlan> (*m_plan);
+    }
+  return *m_plan;
+}
+
 void
 LogicalSigfoxChannelHelper::SetFrequencyRange (double startFrequencyHz, double endFrequencyHz)
 {
-  m_channelSelector->SetAttribute ("Min", DoubleValue (startFrequencyHz));
-  m_channelSelector->SetAttribute ("Max", DoubleValue (endFrequencyHz));
+  GetPrivatePlan ().SetFrequencyRange (startFrequencyHz, endFrequencyHz);
+}
+
+Ptr<UniformRandomVariable>
+LogicalSigfoxChannelHelper::GetChannelSelector (void)
+{
+  if (m_channelSelector == 0)
+    {
+      m_channelSelector = CreateObject<UniformRandomVariable> ();
+      if (m_stream >= 0)
+        {
+          m_channelSelector->SetStream (m_stream);
+        }
+    }
+  return m_channelSelector;
+}
+
+int64_t
+LogicalSigfoxChannelHelper::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  // The random variable is only created when it is needed
+  m_stream = stream;
+  if (m_channelSelector)
+    {
+      m_channelSelector->SetStream (stream);
+    }
+  return 1;
 }
 
 double
 LogicalSigfoxChannelHelper::GetRandomFrequency (void)
 {
-  return m_channelSelector->GetValue();
+  NS_ASSERT (m_plan != 0);
+
+  return GetChannelSelector ()->GetValue (m_plan->GetStartFrequency (),
+                                          m_plan->GetEndFrequency ());
 }
 
 double
 LogicalSigfoxChannelHelper::GetFrequencyFromChannelSet (void)
 {
-  int channelNumber = m_channelSelector->GetInteger (0, 359);
-  // Channels have a fixed 100 Hz bandwidth, starting at 868.180 MHz for channel 0, ending at 868.198
-  // MHz for channel 180, restarting at 868.202 MHz for channel 220 and ending at 868.220 MHz for channel 400.
-  if (channelNumber < 180)
+  return GetFrequencyFromChannelNumber (GetChannelSelector ()->GetInteger (0, nUplinkChannels - 1),
+                                        GetRadioConfiguration ());
+}
+
+double
+LogicalSigfoxChannelHelper::GetFrequencyFromChannelNumber (uint32_t channelNumber,
+                                                           enum SigfoxRadioConfiguration rc)
+{
+  NS_ASSERT (channelNumber < nUplinkChannels);
+
+  // Channels are laid out in two blocks of nUplinkChannels / 2 on either side
+  // of the center of the macro channel, separated by a guard band. In RC1
+  // channels have a 100 Hz bandwidth, starting 20 kHz below the center for
+  // channel 0, ending 2 kHz below it for channel 179, restarting 2 kHz above
+  // it for channel 180 and ending 20 kHz above it for channel 359.
+  const SigfoxRadioConfigurationParameters &params = GetRadioConfigurationParameters (rc);
+  uint32_t blockSize = nUplinkChannels / 2;
+  double spacing = params.uplinkChannelSpacingHz;
+  double center = params.uplinkCenterFrequencyHz;
+
+  if (channelNumber < blockSize)
     {
-      return 868.180e6 + 50 + channelNumber * 100;
+      return center - params.uplinkGuardHz / 2 - (blockSize - channelNumber) * spacing +
+             spacing / 2;
     }
   else
     {
-      return 868.202e6 + 50 + (channelNumber - 180) * 100;
+      return center + params.uplinkGuardHz / 2 + (channelNumber - blockSize) * spacing +
+             spacing / 2;
     }
 }
 
-Ptr<SubBand>
-LogicalSigfoxChannelHelper::GetSubBandFromFrequency (double frequency)
+enum SigfoxRadioConfiguration
+LogicalSigfoxChannelHelper::GetRadioConfiguration (void) const
 {
-  // Get the SubBand this frequency belongs to
-  std::list< Ptr< SubBand > >::iterator it;
-  for (it = m_subBandList.begin (); it != m_subBandList.end (); it++)
+  if (m_plan == 0)
     {
-      if ((*it)->BelongsToSubBand (frequency))
-        {
-          return *it;
-        }
+      return RC1;
     }
+  return m_plan->GetRadioConfiguration ();
+}
 
-  NS_LOG_ERROR ("Requested frequency: " << frequency);
-  NS_ABORT_MSG ("Warning: frequency is outside any known SubBand.");
+uint32_t
+LogicalSigfoxChannelHelper::GetSubBandId (double frequency)
+{
+  NS_ASSERT_MSG (m_plan != 0, "No channel plan was set");
 
-  return 0;     // If no SubBand is found, return 0
+  m_lastSubBandId = m_plan->FindSubBand (frequency, m_lastSubBandId);
+  return m_lastSubBandId;
+}
+
+Ptr<SubBand>
+LogicalSigfoxChannelHelper::GetSubBandFromFrequency (double frequency)
+{
+  return m_plan->GetSubBand (GetSubBandId (frequency));
 }
 
 void
@@ -111,7 +203,7 @@ LogicalSigfoxChannelHelper::AddSubBand (double firstFrequency,
   Ptr<SubBand> subBand = Create<SubBand> (firstFrequency, lastFrequency,
                                           dutyCycle, maxTxPowerDbm);
 
-  m_subBandList.push_back (subBand);
+  AddSubBand (subBand);
 }
 
 void
@@ -119,7 +211,79 @@ LogicalSigfoxChannelHelper::AddSubBand (Ptr<SubBand> subBand)
 {
   NS_LOG_FUNCTION (this << subBand);
 
-  m_subBandList.push_back (subBand);
+  GetPrivatePlan ().AddSubBand (subBand);
+}
+
+void
+LogicalSigfoxChannelHelper::SetDutyCycleWindow (Time window)
+{
+  NS_LOG_FUNCTION (this << window);
+
+  // Bring the buckets up to date with the old capacity
+  for (uint32_t id = 0; id < m_dutyCycleBuckets.size (); id++)
+    {
+      GetDutyCycleBucket (id);
+    }
+
+  GetPrivatePlan ().SetDutyCycleWindow (window);
+
+  for (uint32_t id = 0; id < m_dutyCycleBuckets.size (); id++)
+    {
+      m_dutyCycleBuckets[id].tokens = std::min (m_dutyCycleBuckets[id].tokens,
+                                                m_plan->GetAirTimeCapacity (id));
+    }
+}
+
+void
+LogicalSigfoxChannelHelper::SetDailyMessageQuota (uint32_t quota)
+{
+  NS_LOG_FUNCTION (this << quota);
+
+  Refill (m_quotaBucket, m_dailyMessageQuota, m_dailyMessageQuota / 86400.0);
+  m_dailyMessageQuota = quota;
+  m_quotaBucket.tokens = std::min (m_quotaBucket.tokens, double (quota));
+}
+
+void
+LogicalSigfoxChannelHelper::Refill (TokenBucket &bucket, double capacity, double rate)
+{
+  Time now = Simulator::Now ();
+  bucket.tokens = std::min (capacity,
+                            bucket.tokens + (now - bucket.lastUpdate).GetSeconds () * rate);
+  bucket.lastUpdate = now;
+}
+
+Time
+LogicalSigfoxChannelHelper::GetTimeToTokens (const TokenBucket &bucket, double capacity,
+                                             double rate, double tokens)
+{
+  if (bucket.tokens >= tokens)
+    {
+      return Seconds (0);
+    }
+  if (rate <= 0 || tokens > capacity)
+    {
+      // We will never get there
+      return Time::Max ();
+    }
+  return Seconds ((tokens - bucket.tokens) / rate);
+}
+
+LogicalSigfoxChannelHelper::TokenBucket &
+LogicalSigfoxChannelHelper::GetDutyCycleBucket (uint32_t id)
+{
+  // Buckets start full
+  while (m_dutyCycleBuckets.size () < m_plan->GetNSubBands ())
+    {
+      TokenBucket bucket;
+      bucket.tokens = m_plan->GetAirTimeCapacity (m_dutyCycleBuckets.size ());
+      bucket.lastUpdate = Simulator::Now ();
+      m_dutyCycleBuckets.push_back (bucket);
+    }
+
+  TokenBucket &bucket = m_dutyCycleBuckets[id];
+  Refill (bucket, m_plan->GetAirTimeCapacity (id), m_plan->GetSubBand (id)->GetDutyCycle ());
+  return bucket;
 }
 
 Time
@@ -142,33 +306,69 @@ LogicalSigfoxChannelHelper::GetWaitingTime (double frequencyHz)
 {
   NS_LOG_FUNCTION (this << frequencyHz);
 
-  // SubBand waiting time
-  Time subBandWaitingTime = GetSubBandFromFrequency (frequencyHz)->
-    GetNextTransmissionTime () -
-    Simulator::Now ();
-
-  // Handle case in which waiting time is negative
-  subBandWaitingTime = Seconds (std::max (subBandWaitingTime.GetSeconds (),
-                                          double(0)));
+  // SubBand waiting time: the time it takes to pay back any debt
+  uint32_t id = GetSubBandId (frequencyHz);
+  Time subBandWaitingTime = GetTimeToTokens (GetDutyCycleBucket (id),
+                                             m_plan->GetAirTimeCapacity (id),
+                                             m_plan->GetSubBand (id)->GetDutyCycle (), 0);
 
   NS_LOG_DEBUG ("Waiting time: " << subBandWaitingTime.GetSeconds ());
 
   return subBandWaitingTime;
 }
 
+Time
+LogicalSigfoxChannelHelper::GetTransmissionWaitingTime (Time airTime, double frequencyHz)
+{
+  NS_LOG_FUNCTION (this << airTime << frequencyHz);
+
+  uint32_t id = GetSubBandId (frequencyHz);
+  Time waitingTime = GetTimeToTokens (GetDutyCycleBucket (id),
+                                      m_plan->GetAirTimeCapacity (id),
+                                      m_plan->GetSubBand (id)->GetDutyCycle (),
+                                      airTime.GetSeconds ());
+
+  if (m_dailyMessageQuota > 0)
+    {
+      double rate = m_dailyMessageQuota / 86400.0;
+      Refill (m_quotaBucket, m_dailyMessageQuota, rate);
+      waitingTime = std::max (waitingTime,
+                              GetTimeToTokens (m_quotaBucket, m_dailyMessageQuota, rate, 1));
+    }
+
+  waitingTime = std::max (waitingTime, GetAggregatedWaitingTime ());
+
+  NS_LOG_DEBUG ("Waiting time for " << airTime.GetSeconds () << " s of airtime: " <<
+                waitingTime.GetSeconds ());
+
+  return waitingTime;
+}
+
+void
+LogicalSigfoxChannelHelper::AddMessage (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_dailyMessageQuota > 0)
+    {
+      Refill (m_quotaBucket, m_dailyMessageQuota, m_dailyMessageQuota / 86400.0);
+      m_quotaBucket.tokens -= 1;
+    }
+}
+
 void
 LogicalSigfoxChannelHelper::AddEvent (Time duration, double frequencyHz)
 {
   NS_LOG_FUNCTION (this << duration << frequencyHz);
 
-  Ptr<SubBand> subBand = GetSubBandFromFrequency (frequencyHz);
-
-  // TODO Fix this mess
-  double dutyCycle = 0.0;
+  uint32_t id = GetSubBandId (frequencyHz);
   double timeOnAir = duration.GetSeconds ();
 
-  // Computation of necessary waiting time on this sub-band
-  subBand->SetNextTransmissionTime (Simulator::Now () + Seconds (timeOnAir + dutyCycle));
+  // Take the airtime from the bucket of this sub-band. The SubBand itself
+  // belongs to the shared plan, so its next transmission time is not updated.
+  TokenBucket &bucket = GetDutyCycleBucket (id);
+  bucket.tokens -= timeOnAir;
+
   // Computation of necessary aggregate waiting time
   m_nextAggregatedTransmissionTime = Simulator::Now () + Seconds
       (timeOnAir / m_aggregatedDutyCycle - timeOnAir);
@@ -176,8 +376,7 @@ LogicalSigfoxChannelHelper::AddEvent (Time duration, double frequencyHz)
   NS_LOG_DEBUG ("Time on air: " << timeOnAir);
   NS_LOG_DEBUG ("m_aggregatedDutyCycle: " << m_aggregatedDutyCycle);
   NS_LOG_DEBUG ("Current time: " << Simulator::Now ().GetSeconds ());
-  NS_LOG_DEBUG ("Next transmission on this sub-band allowed at time: " <<
-                (subBand->GetNextTransmissionTime ()).GetSeconds ());
+  NS_LOG_DEBUG ("Airtime left on this sub-band: " << bucket.tokens);
   NS_LOG_DEBUG ("Next aggregated transmission allowed at time " <<
                 m_nextAggregatedTransmissionTime.GetSeconds ());
 }
@@ -188,18 +387,7 @@ LogicalSigfoxChannelHelper::GetTxPowerForFrequency (double frequencyHz)
   NS_LOG_FUNCTION_NOARGS ();
 
   // Get the maxTxPowerDbm from the SubBand this channel is in
-  std::list< Ptr< SubBand > >::iterator it;
-  for (it = m_subBandList.begin (); it != m_subBandList.end (); it++)
-    {
-      // Check whether this channel is in this SubBand
-      if ((*it)->BelongsToSubBand (frequencyHz))
-        {
-          return (*it)->GetMaxTxPowerDbm ();
-        }
-    }
-  NS_ABORT_MSG ("Frequency doesn't belong to a known SubBand");
-
-  return 0;
+  return GetSubBandFromFrequency (frequencyHz)->GetMaxTxPowerDbm ();
 }
 }
 }
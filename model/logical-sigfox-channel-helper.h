@@ -26,8 +26,7 @@
 #include "ns3/packet.h"
 #include "ns3/random-variable-stream.h"
 #include "ns3/sub-band.h"
-#include <list>
-#include <iterator>
+#include "ns3/sigfox-channel-plan.h"
 #include <vector>
 
 namespace ns3 {
@@ -41,6 +40,23 @@ namespace sigfox {
  * This class also takes into account duty cycle limitations, by updating a list
  * of SubBand objects and providing methods to query whether transmission on a
  * set channel is admissible or not.
+ *
+ * The SubBands and the frequency range are described by a SigfoxChannelPlan,
+ * which is typically shared by all the devices of a region: this class only
+ * holds the state that is specific to one device. Methods that change the
+ * plan (AddSubBand, SetFrequencyRange, SetDutyCycleWindow) make a private copy
+ * of it first if it is shared.
+ *
+ * Regulatory limits are enforced with token buckets, so that every check is
+ * constant time:
+ * - each SubBand has a bucket of airtime, that refills at the rate given by
+ *   the SubBand's duty cycle and holds at most the airtime allowed over the
+ *   duty cycle window (one hour by default, as per ETSI EN 300 220). With a
+ *   1% duty cycle, this means 36 seconds every hour;
+ * - a bucket of messages enforces the daily quota of the Sigfox
+ *   subscription (140 uplink messages per day by default).
+ * Buckets start full, and AddEvent is allowed to bring a bucket below zero:
+ * in that case, the waiting time is the time it takes to pay back the debt.
  */
 class LogicalSigfoxChannelHelper : public Object
 {
@@ -50,12 +66,56 @@ public:
   LogicalSigfoxChannelHelper ();
   virtual ~LogicalSigfoxChannelHelper ();
 
+  /**
+   * Set the channel plan this device uses. The per-device duty cycle state is
+   * reset.
+   *
+   * \param plan The plan, which may be shared with other devices.
+   */
+  void SetChannelPlan (Ptr<SigfoxChannelPlan> plan);
+
+  /**
+   * Get the channel plan this device uses.
+   *
+   * \return The plan, which must not be modified.
+   */
+  Ptr<const SigfoxChannelPlan> GetChannelPlan (void) const;
+
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by this helper.
+   *
+   * \param stream The first stream index to use.
+   * \return The number of stream indices assigned by this helper.
+   */
+  int64_t AssignStreams (int64_t stream);
+
   void SetFrequencyRange (double startFrequencyHz, double endFrequencyHz);
 
   double GetRandomFrequency (void);
 
   double GetFrequencyFromChannelSet (void);
 
+  /**
+   * Get the center frequency of a channel of the uplink channel set.
+   *
+   * \param channelNumber The channel, between 0 and nUplinkChannels
+   * (excluded).
+   * \param rc The radio configuration the channel set belongs to.
+   * \return The center frequency of the channel, in Hz.
+   */
+  static double GetFrequencyFromChannelNumber (uint32_t channelNumber,
+                                               enum SigfoxRadioConfiguration rc = RC1);
+
+  /**
+   * Get the radio configuration of the channel plan.
+   *
+   * \return The radio configuration, RC1 if no plan was set.
+   */
+  enum SigfoxRadioConfiguration GetRadioConfiguration (void) const;
+
+  static const uint32_t nUplinkChannels = 360; //!< Size of the uplink channel set
+
   /**
    * Get the time it is necessary to wait before transmitting again, according
    * to the aggregate duty cycle timer.
@@ -78,6 +138,18 @@ public:
    */
   Time GetWaitingTime (double frequencyHz);
 
+  /**
+   * Get the time it is necessary to wait for before a message can be sent,
+   * taking into account both the duty cycle of the SubBand and the daily
+   * message quota.
+   *
+   * \param airTime The total time on air of the message, repetitions
+   * included.
+   * \param frequencyHz A frequency in the SubBand the message will be sent in.
+   * \return The waiting time, zero if the message can be sent right away.
+   */
+  Time GetTransmissionWaitingTime (Time airTime, double frequencyHz);
+
   /**
    * Register the transmission of a packet.
    *
@@ -86,11 +158,32 @@ public:
    */
   void AddEvent (Time duration, double frequencyHz);
 
+  /**
+   * Register a message against the daily message quota.
+   */
+  void AddMessage (void);
+
+  /**
+   * Set the window over which the duty cycle of SubBands is enforced, i.e.,
+   * the longest burst of transmissions a device can make after a long
+   * silence is dutyCycle * window.
+   *
+   * \param window The duty cycle window.
+   */
+  void SetDutyCycleWindow (Time window);
+
+  /**
+   * Set the maximum number of messages that can be sent in a day.
+   *
+   * \param quota The number of messages, zero to disable the quota.
+   */
+  void SetDailyMessageQuota (uint32_t quota);
+
   /**
    * Add a new SubBand to this helper.
    *
-   * \param firstFrequency The first frequency of the subband, in MHz.
-   * \param lastFrequency The last frequency of the subband, in MHz.
+   * \param firstFrequency The first frequency of the subband, in Hz.
+   * \param lastFrequency The last frequency of the subband, in Hz.
    * \param dutyCycle The duty cycle that needs to be enforced on this subband.
    * \param maxTxPowerDbm The maximum transmission power [dBm] that can be used
    * on this SubBand.
@@ -122,11 +215,82 @@ public:
    */
   Ptr<SubBand> GetSubBandFromFrequency (double frequency);
 
+  /**
+   * Get the index of the SubBand a frequency belongs to.
+   *
+   * SubBands are numbered in the order they were added.
+   *
+   * \param frequency The frequency we want to check.
+   * \return The index of the SubBand the frequency belongs to.
+   */
+  uint32_t GetSubBandId (double frequency);
+
 private:
   /**
-   * A list of the SubBands that are currently registered within this helper.
+   * A token bucket, refilled continuously. The capacity and the refill rate
+   * are not stored, since they only depend on the channel plan.
+   */
+  struct TokenBucket
+  {
+    double tokens;     //!< The tokens in the bucket at lastUpdate
+    Time lastUpdate;   //!< The last time the bucket was refilled
+  };
+
+  /**
+   * Bring a bucket up to date with the current time.
+   *
+   * \param bucket The bucket to refill.
+   * \param capacity The maximum number of tokens.
+   * \param rate The tokens gained per second.
+   */
+  static void Refill (TokenBucket &bucket, double capacity, double rate);
+
+  /**
+   * Get the time it takes for a bucket to hold a number of tokens.
+   *
+   * \param bucket The bucket, which must be up to date.
+   * \param capacity The maximum number of tokens.
+   * \param rate The tokens gained per second.
+   * \param tokens The number of tokens that are needed.
+   */
+  static Time GetTimeToTokens (const TokenBucket &bucket, double capacity, double rate,
+                               double tokens);
+
+  /**
+   * Get the airtime bucket of a SubBand, brought up to date.
+   *
+   * \param id The index of the SubBand.
+   */
+  TokenBucket &GetDutyCycleBucket (uint32_t id);
+
+  /**
+   * Make sure that the plan is not shared before it is modified.
+   */
+  SigfoxChannelPlan &GetPrivatePlan (void);
+
+  /**
+   * The channel plan, possibly shared with other devices.
+   */
+  Ptr<SigfoxChannelPlan> m_plan;
+
+  /**
+   * The airtime buckets of the SubBands, indexed by SubBand id. These are
+   * created the first time they are needed.
+   */
+  std::vector<TokenBucket> m_dutyCycleBuckets;
+
+  /**
+   * The bucket enforcing the daily message quota.
+   */
+  TokenBucket m_quotaBucket;
+
+  uint32_t m_dailyMessageQuota; //!< Messages per day, zero if disabled
+
+  /**
+   * The SubBand that matched the last lookup. Devices almost always stay in
+   * the same SubBand, so it is checked first.
    */
-  std::list<Ptr <SubBand> > m_subBandList;
+  uint32_t m_lastSubBandId;
 
   Time m_nextAggregatedTransmissionTime; //!< The next time at which
   //!transmission will be possible
@@ -138,7 +302,21 @@ private:
   //!according to the aggregated
   //!transmission timer
 
+  /**
+   * The random variable used to choose frequencies, created the first time
+   * it is needed.
+   */
   Ptr<UniformRandomVariable> m_channelSelector;
+
+  /**
+   * The stream assigned to m_channelSelector, or -1 if none was.
+   */
+  int64_t m_stream;
+
+  /**
+   * Get the random variable used to choose frequencies.
+   */
+  Ptr<UniformRandomVariable> GetChannelSelector (void);
 };
 }
 
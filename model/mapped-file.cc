@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/mapped-file.h"
+#include "ns3/fatal-error.h"
+#include "ns3/log.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("MappedFile");
+
+MappedFile::MappedFile (std::string path)
+  : m_path (path),
+    m_data (0),
+    m_size (0)
+{
+  NS_LOG_FUNCTION (this << path);
+
+  int fd = open (path.c_str (), O_RDONLY);
+  if (fd < 0)
+    {
+      NS_FATAL_ERROR ("Cannot open " << path << ": " << std::strerror (errno));
+    }
+
+  struct stat st;
+  if (fstat (fd, &st) < 0)
+    {
+      close (fd);
+      NS_FATAL_ERROR ("Cannot stat " << path << ": " << std::strerror (errno));
+    }
+
+  m_size = st.st_size;
+  if (m_size == 0)
+    {
+      close (fd);
+      NS_FATAL_ERROR (path << " is empty");
+    }
+
+  void *data = mmap (0, m_size, PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping stays valid after the descriptor is closed
+  close (fd);
+  if (data == MAP_FAILED)
+    {
+      NS_FATAL_ERROR ("Cannot map " << path << ": " << std::strerror (errno));
+    }
+
+  m_data = static_cast<const uint8_t *> (data);
+  NS_LOG_DEBUG ("Mapped " << m_size << " bytes from " << path);
+}
+
+MappedFile::~MappedFile ()
+{
+  NS_LOG_FUNCTION (this);
+
+  munmap (const_cast<uint8_t *> (m_data), m_size);
+}
+
+const uint8_t *
+MappedFile::GetData (void) const
+{
+  return m_data;
+}
+
+uint64_t
+MappedFile::GetSize (void) const
+{
+  return m_size;
+}
+
+std::string
+MappedFile::GetPath (void) const
+{
+  return m_path;
+}
+
+void
+MappedFile::Release (uint64_t offset, uint64_t length) const
+{
+  NS_LOG_FUNCTION (this << offset << length);
+
+  uint64_t pageSize = sysconf (_SC_PAGESIZE);
+  uint64_t start = (offset + pageSize - 1) / pageSize * pageSize;
+  uint64_t end = std::min (offset + length, m_size) / pageSize * pageSize;
+
+  if (start < end)
+    {
+      // The mapping is read-only: the pages are read again from the file if
+      // they are ever needed
+      madvise (const_cast<uint8_t *> (m_data) + start, end - start, MADV_DONTNEED);
+    }
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,83 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <stdint.h>
+#include <string>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * A file mapped read-only in memory.
+ *
+ * Pages are only read from disk when they are accessed, and since they are
+ * never modified the kernel can drop them again under memory pressure, so
+ * that traces much larger than the available memory can be replayed.
+ */
+class MappedFile
+{
+public:
+  /**
+   * Map a file. Aborts the simulation if the file cannot be mapped.
+   *
+   * \param path The path of the file.
+   */
+  MappedFile (std::string path);
+  ~MappedFile ();
+
+  /**
+   * Get the start of the mapping.
+   */
+  const uint8_t *GetData (void) const;
+
+  /**
+   * Get the size of the file, in bytes.
+   */
+  uint64_t GetSize (void) const;
+
+  /**
+   * Get the path of the file.
+   */
+  std::string GetPath (void) const;
+
+  /**
+   * Tell the kernel that a range of the file will not be read again for a
+   * while, so that its pages can be released right away. Only the pages
+   * that are entirely within the range are released.
+   *
+   * \param offset The start of the range, in bytes.
+   * \param length The length of the range, in bytes.
+   */
+  void Release (uint64_t offset, uint64_t length) const;
+
+private:
+  MappedFile (const MappedFile &);
+  MappedFile &operator = (const MappedFile &);
+
+  std::string m_path;    //!< The mapped file
+  const uint8_t *m_data; //!< The start of the mapping
+  uint64_t m_size;       //!< The size of the mapping, in bytes
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* MAPPED_FILE_H */
@@ -0,0 +1,211 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/periodic-load-energy-model.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("PeriodicLoadEnergyModel");
+
+NS_OBJECT_ENSURE_REGISTERED (PeriodicLoadEnergyModel);
+
+TypeId
+PeriodicLoadEnergyModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::PeriodicLoadEnergyModel")
+    .SetParent<DeviceEnergyModel> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<PeriodicLoadEnergyModel> ()
+    .AddAttribute ("Period",
+                   "The period of the load",
+                   TimeValue (Seconds (60)),
+                   MakeTimeAccessor (&PeriodicLoadEnergyModel::m_period),
+                   MakeTimeChecker (NanoSeconds (1)))
+    .AddAttribute ("PulseDuration",
+                   "How long the pulse of each period lasts",
+                   TimeValue (Seconds (1)),
+                   MakeTimeAccessor (&PeriodicLoadEnergyModel::m_pulseDuration),
+                   MakeTimeChecker (Seconds (0)))
+    .AddAttribute ("Offset",
+                   "When the first pulse starts, after the model is attached "
+                   "to its energy source. Only the base current is drawn "
+                   "before it.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&PeriodicLoadEnergyModel::m_offset),
+                   MakeTimeChecker (Seconds (0)))
+    .AddAttribute ("PulseCurrentA",
+                   "The current drawn during a pulse, on top of the base current",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&PeriodicLoadEnergyModel::m_pulseCurrentA),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("BaseCurrentA",
+                   "The current drawn all the time",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&PeriodicLoadEnergyModel::m_baseCurrentA),
+                   MakeDoubleChecker<double> (0))
+  ;
+  return tid;
+}
+
+PeriodicLoadEnergyModel::PeriodicLoadEnergyModel ()
+  : m_active (false),
+    m_pulsing (false),
+    m_pastEnergy (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+PeriodicLoadEnergyModel::~PeriodicLoadEnergyModel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+PeriodicLoadEnergyModel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_pulsesEvent.Cancel ();
+  m_source = 0;
+  DeviceEnergyModel::DoDispose ();
+}
+
+void
+PeriodicLoadEnergyModel::SetEnergySource (Ptr<EnergySource> source)
+{
+  NS_LOG_FUNCTION (this << source);
+  NS_ASSERT (source != 0);
+  NS_ASSERT_MSG (m_pulseDuration <= m_period, "The pulse is longer than the period");
+
+  m_source = source;
+  Start ();
+}
+
+void
+PeriodicLoadEnergyModel::Start (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_active = true;
+  m_pulsing = false;
+  m_startTime = Simulator::Now ();
+  m_pulsesEvent = Simulator::Schedule (m_offset, &PeriodicLoadEnergyModel::StartPulses, this);
+}
+
+void
+PeriodicLoadEnergyModel::StartPulses (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  // Account for the base current up to now before the pulses add to it
+  m_source->UpdateEnergySource ();
+  m_pulsing = true;
+}
+
+double
+PeriodicLoadEnergyModel::GetAverageCurrentA (void) const
+{
+  return m_baseCurrentA + m_pulseCurrentA * m_pulseDuration.GetSeconds () / m_period.GetSeconds ();
+}
+
+double
+PeriodicLoadEnergyModel::GetPulseEnergy (void) const
+{
+  NS_ASSERT (m_source != 0);
+  return m_pulseCurrentA * m_pulseDuration.GetSeconds () * m_source->GetSupplyVoltage ();
+}
+
+double
+PeriodicLoadEnergyModel::GetDrainedCharge (Time elapsed) const
+{
+  double charge = m_baseCurrentA * elapsed.GetSeconds ();
+
+  // The source sees the average of the pulses once they have started
+  Time sincePulses = elapsed - m_offset;
+  if (sincePulses.IsStrictlyPositive ())
+    {
+      charge += (GetAverageCurrentA () - m_baseCurrentA) * sincePulses.GetSeconds ();
+    }
+
+  return charge;
+}
+
+double
+PeriodicLoadEnergyModel::GetTotalEnergyConsumption (void) const
+{
+  if (!m_active)
+    {
+      return m_pastEnergy;
+    }
+  return m_pastEnergy +
+         GetDrainedCharge (Simulator::Now () - m_startTime) * m_source->GetSupplyVoltage ();
+}
+
+void
+PeriodicLoadEnergyModel::ChangeState (int newState)
+{
+  // The load has no states of its own
+}
+
+void
+PeriodicLoadEnergyModel::HandleEnergyDepletion (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_active)
+    {
+      // The source was just updated, and will read our new current when it
+      // predicts its next threshold
+      m_pastEnergy = GetTotalEnergyConsumption ();
+      m_active = false;
+      m_pulsing = false;
+      m_pulsesEvent.Cancel ();
+    }
+}
+
+void
+PeriodicLoadEnergyModel::HandleEnergyRecharged (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (!m_active)
+    {
+      Start ();
+    }
+}
+
+void
+PeriodicLoadEnergyModel::HandleEnergyChanged (void)
+{
+}
+
+double
+PeriodicLoadEnergyModel::DoGetCurrentA (void) const
+{
+  if (!m_active)
+    {
+      return 0;
+    }
+  return m_pulsing ? GetAverageCurrentA () : m_baseCurrentA;
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef PERIODIC_LOAD_ENERGY_MODEL_H
+#define PERIODIC_LOAD_ENERGY_MODEL_H
+
+#include "ns3/device-energy-model.h"
+#include "ns3/energy-source.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * \ingroup energy
+ *
+ * The consumption of a periodic activity of a device other than its radio,
+ * such as measuring a sensor or waking up the MCU.
+ *
+ * The device draws BaseCurrentA, plus PulseCurrentA for PulseDuration once
+ * every Period, the first pulse starting Offset after the model is attached
+ * to its energy source. No event is scheduled per pulse: from Offset on, the
+ * energy source sees the average current of the profile, so its remaining
+ * energy is exact at the end of each period. The total consumption of the
+ * model, in Joules, is the energy drained from the source, computed in
+ * closed form whenever it is asked for.
+ *
+ * The load stops when the source is depleted, and resumes when it is
+ * recharged, with its first pulse Offset later.
+ */
+class PeriodicLoadEnergyModel : public DeviceEnergyModel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  PeriodicLoadEnergyModel ();
+  virtual ~PeriodicLoadEnergyModel ();
+
+  /**
+   * \return The current drawn on average over a period.
+   */
+  double GetAverageCurrentA (void) const;
+
+  /**
+   * \return The energy drawn by one pulse on top of the base current, in
+   * Joules.
+   */
+  double GetPulseEnergy (void) const;
+
+  // Implementation of DeviceEnergyModel's pure virtual functions
+  virtual void SetEnergySource (Ptr<EnergySource> source);
+  virtual double GetTotalEnergyConsumption (void) const;
+  virtual void ChangeState (int newState);
+  virtual void HandleEnergyDepletion (void);
+  virtual void HandleEnergyRecharged (void);
+  virtual void HandleEnergyChanged (void);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  virtual double DoGetCurrentA (void) const;
+
+  /**
+   * Start drawing the base current, and schedule the start of the pulses.
+   */
+  void Start (void);
+
+  /**
+   * Add the average current of the pulses to the base current.
+   */
+  void StartPulses (void);
+
+  /**
+   * \param elapsed The time since the load was started.
+   * \return The charge drained from the source over that time.
+   */
+  double GetDrainedCharge (Time elapsed) const;
+
+  Ptr<EnergySource> m_source; //!< The energy source
+
+  Time m_period;              //!< The period of the profile
+  Time m_pulseDuration;       //!< The duration of a pulse
+  Time m_offset;              //!< The start of the first pulse
+  double m_pulseCurrentA;     //!< The current drawn during a pulse, on top of the base
+  double m_baseCurrentA;      //!< The current drawn all the time
+
+  bool m_active;              //!< Whether the load is drawing current
+  bool m_pulsing;             //!< Whether the pulses have started
+  EventId m_pulsesEvent;      //!< The start of the pulses
+  Time m_startTime;           //!< When the load was last started
+  double m_pastEnergy;        //!< The energy drawn before the last start, in Joules
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* PERIODIC_LOAD_ENERGY_MODEL_H */
@@ -27,9 +27,10 @@
 #include "ns3/double.h"
 #include "ns3/string.h"
 #include "ns3/sigfox-net-device.h"
+#include "ns3/sigfox-radio-configuration.h"
 #include "ns3/random-variable-stream.h"
-#include "ns3/rng-seed-manager.h"
 #include "ns3/uinteger.h"
+#include <algorithm>
 
 namespace ns3 {
 namespace sigfox {
@@ -49,7 +50,22 @@ PeriodicSender::GetTypeId (void)
                    TimeValue (Seconds (0)),
                    MakeTimeAccessor (&PeriodicSender::GetInterval,
                                      &PeriodicSender::SetInterval),
-                   MakeTimeChecker ());
+                   MakeTimeChecker ())
+    .AddAttribute ("SensorTraceFile",
+                   "The file of measurements used by the Data Compression Strategy",
+                   StringValue ("src/sigfox/data/sensor-trace.bin"),
+                   MakeStringAccessor (&PeriodicSender::m_sensorTraceFile),
+                   MakeStringChecker ())
+    .AddAttribute ("SensorTracePhase",
+                   "The index of the first measurement read by this application",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&PeriodicSender::m_sensorTraceCursor),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("WeatherProcess",
+                   "The weather seen by the Weather Driven Strategy",
+                   PointerValue (),
+                   MakePointerAccessor (&PeriodicSender::m_weather),
+                   MakePointerChecker<WeatherProcess> ());
   // .AddAttribute ("PacketSizeRandomVariable", "The random variable that determines the shape of the packet size, in bytes",
   //                StringValue ("ns3::UniformRandomVariable[Min=0,Max=10]"),
   //                MakePointerAccessor (&PeriodicSender::m_pktSizeRV),
@@ -60,11 +76,18 @@ PeriodicSender::GetTypeId (void)
 PeriodicSender::PeriodicSender ()
   : m_interval (Seconds (10)),
   m_initialDelay (Seconds (1)),
+  m_randomInitialDelay (false),
+  m_running (false),
+  m_suspended (false),
   m_basePktSize (10),
-  m_pktSizeRV (0)
+  m_pktSizeRV (0),
+  m_sensorTraceCursor (0)
 
 {
   NS_LOG_FUNCTION_NOARGS ();
+
+  m_intervalRV = CreateObject<UniformRandomVariable> ();
+  m_initialDelayRV = CreateObject<UniformRandomVariable> ();
 }
 
 PeriodicSender::~PeriodicSender ()
@@ -93,6 +116,13 @@ PeriodicSender::SetInitialDelay (Time delay)
   m_initialDelay = delay;
 }
 
+void
+PeriodicSender::SetRandomInitialDelay (bool random)
+{
+  NS_LOG_FUNCTION (this << random);
+  m_randomInitialDelay = random;
+}
+
 
 void
 PeriodicSender::SetPacketSizeRandomVariable (Ptr <RandomVariableStream> rv)
@@ -107,60 +137,72 @@ PeriodicSender::SetPacketSize (uint8_t size)
   m_basePktSize = size;
 }
 
+void
+PeriodicSender::SetSensorTracePhase (uint32_t phase)
+{
+  m_sensorTraceCursor = phase;
+}
+
 // ***********for Data compression ******************
 void PeriodicSender::EnableSendingData(void)
 {
-    new_msr= data[i];
-    i += 1;
-    NS_LOG_DEBUG ("Measured value is============== "<<new_msr );
-    if(i==10789)
+    if (m_sensorTrace == 0)
     {
-        i =0;
+        m_sensorTrace = SensorTraceStore::Open (m_sensorTraceFile);
     }
+    new_msr = m_sensorTrace->GetSample (m_sensorTraceCursor++);
+    NS_LOG_DEBUG ("Measured value is============== "<<new_msr );
     if(abs(old_msr - new_msr) >30)
     {
         sending = true;
         old_msr = new_msr;
     }
     
-    Simulator::Schedule (Seconds (600.0), &PeriodicSender::EnableSendingData, this);
+    m_sensorEvent = Simulator::Schedule (Seconds (600.0), &PeriodicSender::EnableSendingData, this);
 }
 // ***********  for Weather Driven Strategy    ******************
 void PeriodicSender::EnableSendingWeather(void)
 {
-    ns3::RngSeedManager::SetSeed (3);  // Changes seed from default of 1 to 3
-    ns3::RngSeedManager::SetRun (5);   // Changes run number from default of 1 to 7
-    
-    // ************   For Rainy model  *************************
-    // ************   using rand command  *************************
-    //double random_value = (double)rand()/RAND_MAX;
-    
-    // ************   UniformRandomVariable  *************************
-    //Ptr<UniformRandomVariable> x = CreateObject<UniformRandomVariable> ();
-    
-    // ************   ExponentialRandomVariable  *************************
-    //Ptr<ExponentialRandomVariable> y = CreateObject<ExponentialRandomVarlable> ();
-    
-    // ************   ExponentialRandomVariable  *************************
-    double mean = 0.5;
-    double bound = 1.0;
-     
-    Ptr<ExponentialRandomVariable> x = CreateObject<ExponentialRandomVariable> ();
-    x->SetAttribute ("Mean", DoubleValue (mean));
-    x->SetAttribute ("Bound", DoubleValue (bound));
-    
-    double random_value = x->GetValue();
-    NS_LOG_DEBUG ("============== " <<random_value);
-    
-    if (random_value < 0.48)
+    if (m_weather == 0)
+    {
+        m_weather = CreateObject<WeatherProcess> ();
+    }
+
+    if (m_weather->IsRainy ())
     {
         m_interval= Seconds (600);
-        NS_LOG_DEBUG ("It is rainy============== " <<m_interval<<"============== " <<random_value);
+        NS_LOG_DEBUG ("It is rainy============== " <<m_interval);
     }else{
         m_interval= Seconds (1800);
         NS_LOG_DEBUG ("It is Not rainy============== "<<m_interval );
     }
-    // ********************************************************
+}
+
+void
+PeriodicSender::SetFleetTrafficGenerator (Ptr<FleetTrafficGenerator> fleet)
+{
+  m_fleet = fleet;
+}
+
+void
+PeriodicSender::SetWeatherProcess (Ptr<WeatherProcess> weather)
+{
+  m_weather = weather;
+}
+
+int64_t
+PeriodicSender::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  m_intervalRV->SetStream (stream);
+  m_initialDelayRV->SetStream (stream + 1);
+  if (m_pktSizeRV)
+    {
+      m_pktSizeRV->SetStream (stream + 2);
+      return 3;
+    }
+  return 2;
 }
 
 void
@@ -176,7 +218,8 @@ PeriodicSender::SendPacket (void)
   Ptr<Packet> packet;
   if (m_pktSizeRV)
     {
-      packet = Create<Packet> (m_basePktSize);
+      uint32_t size = m_basePktSize + m_pktSizeRV->GetInteger ();
+      packet = Create<Packet> (std::min (size, maxUplinkPayloadSize));
     }
   else
     {
@@ -198,9 +241,12 @@ PeriodicSender::SendPacket (void)
         
         
 
-  // Schedule the next SendPacket event
-  m_sendEvent = Simulator::Schedule (m_interval, &PeriodicSender::SendPacket,
-                                     this);
+  // Schedule the next SendPacket event, unless the fleet generator does it
+  if (m_fleet == 0)
+    {
+      m_sendEvent = Simulator::Schedule (m_interval, &PeriodicSender::SendPacket,
+                                         this);
+    }
 
   //NS_LOG_DEBUG ("Sent a packet of size " << packet->GetSize ());
   //    int x= 0; x = Sendfrequency ();
@@ -256,11 +302,51 @@ PeriodicSender::StartApplication (void)
       NS_ASSERT (m_mac != 0);
     }
 
+  if (m_interval.IsZero ())
+    {
+      // Based on TR 45.820
+      double intervalProb = m_intervalRV->GetValue ();
+      NS_LOG_DEBUG ("IntervalProb = " << intervalProb);
+      if (intervalProb < 0.4)
+        {
+          m_interval = Days (1);
+        }
+      else if (intervalProb < 0.8)
+        {
+          m_interval = Hours (2);
+        }
+      else if (intervalProb < 0.95)
+        {
+          m_interval = Hours (1);
+        }
+      else
+        {
+          m_interval = Minutes (30);
+        }
+      NS_LOG_DEBUG ("Drew an interval of " << m_interval.GetHours () << " hours");
+    }
+  if (m_randomInitialDelay)
+    {
+      m_initialDelay = Seconds (m_initialDelayRV->GetValue (0, m_interval.GetSeconds ()));
+    }
+
   // Schedule the next SendPacket event
   Simulator::Cancel (m_sendEvent);
+  m_running = true;
+  if (m_suspended)
+    {
+      // Resume will schedule it
+      return;
+    }
   NS_LOG_DEBUG ("Starting up application with a first event with a " <<
                 m_initialDelay.GetSeconds () << " seconds delay");
 
+  if (m_fleet != 0)
+    {
+      m_fleet->AddSender (this, m_initialDelay);
+      return;
+    }
+
   m_sendEvent = Simulator::Schedule (m_initialDelay,
                                      &PeriodicSender::SendPacket, this);
   NS_LOG_DEBUG ("Event Id: " << m_sendEvent.GetUid ());
@@ -270,7 +356,71 @@ void
 PeriodicSender::StopApplication (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
+  m_running = false;
+  Simulator::Cancel (m_sendEvent);
+  if (m_fleet != 0)
+    {
+      m_fleet->RemoveSender (this);
+    }
+}
+
+void
+PeriodicSender::Suspend (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_suspended)
+    {
+      return;
+    }
+  m_suspended = true;
+
   Simulator::Cancel (m_sendEvent);
+  Simulator::Cancel (m_sensorEvent);
+  if (m_running && m_fleet != 0)
+    {
+      m_fleet->RemoveSender (this);
+    }
+}
+
+void
+PeriodicSender::Resume (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (!m_suspended)
+    {
+      return;
+    }
+  m_suspended = false;
+
+  if (EnableDataModel)
+    {
+      m_sensorEvent = Simulator::Schedule (Seconds (600.0), &PeriodicSender::EnableSendingData, this);
+    }
+
+  if (!m_running)
+    {
+      return;
+    }
+
+  if (m_fleet != 0)
+    {
+      m_fleet->AddSender (this, m_interval);
+      return;
+    }
+  m_sendEvent = Simulator::Schedule (m_interval, &PeriodicSender::SendPacket, this);
+}
+
+void
+PeriodicSender::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  // The generator holds a reference to us
+  m_fleet = 0;
+  m_mac = 0;
+  Application::DoDispose ();
 }
 
 }
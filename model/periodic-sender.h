@@ -28,6 +28,10 @@
 #include "ns3/nstime.h"
 #include "ns3/sigfox-mac.h"
 #include "ns3/attribute.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/sensor-trace-store.h"
+#include "ns3/weather-process.h"
+#include "ns3/fleet-traffic-generator.h"
 
 namespace ns3 {
 namespace sigfox {
@@ -40,21535 +44,15 @@ public:
     bool sending = false;
     int new_msr=0;
     int old_msr =0;
-    
-    int data [10789] = { 133    ,
-        138    ,
-        142    ,
-        143    ,
-        146    ,
-        148    ,
-        132    ,
-        119    ,
-        120    ,
-        124    ,
-        128    ,
-        130    ,
-        135    ,
-        134    ,
-        140    ,
-        140    ,
-        143    ,
-        145    ,
-        147    ,
-        148    ,
-        141    ,
-        120    ,
-        106    ,
-        110    ,
-        112    ,
-        116    ,
-        116    ,
-        123    ,
-        127    ,
-        130    ,
-        133    ,
-        137    ,
-        141    ,
-        144    ,
-        150    ,
-        138    ,
-        118    ,
-        122    ,
-        130    ,
-        138    ,
-        145    ,
-        152    ,
-        139    ,
-        120    ,
-        125    ,
-        137    ,
-        144    ,
-        147    ,
-        137    ,
-        129    ,
-        119    ,
-        138    ,
-        154    ,
-        148    ,
-            
-        143    ,
-            
-        137    ,
-            
-        131    ,
-            
-        128    ,
-            
-        124    ,
-            
-        121    ,
-            
-        120    ,
-            
-        123    ,
-            
-        129    ,
-            
-        139    ,
-            
-        150    ,
-            
-        164    ,
-            
-        175    ,
-            
-        175    ,
-            
-        178    ,
-            
-        182    ,
-            
-        185    ,
-            
-        188    ,
-            
-        190    ,
-            
-        191    ,
-            
-        192    ,
-            
-        195    ,
-            
-        196    ,
-            
-        199    ,
-            
-        200    ,
-            
-        202    ,
-            
-        202    ,
-            
-        204    ,
-            
-        206    ,
-            
-        206    ,
-            
-        208    ,
-            
-        210    ,
-            
-        212    ,
-            
-        214    ,
-            
-        216    ,
-            
-        217    ,
-            
-        219    ,
-            
-        222    ,
-            
-        223    ,
-            
-        225    ,
-            
-        227    ,
-            
-        227    ,
-            
-        229    ,
-            
-        230    ,
-            
-        231    ,
-            
-        230    ,
-            
-        233    ,
-            
-        231    ,
-            
-        234    ,
-            
-        233    ,
-            
-        234    ,
-            
-        235    ,
-            
-        236    ,
-            
-        236    ,
-            
-        237    ,
-            
-        239    ,
-            
-        240    ,
-            
-        239    ,
-            
-        240    ,
-            
-        240    ,
-            
-        243    ,
-            
-        243    ,
-            
-        244    ,
-            
-        242    ,
-            
-        243    ,
-            
-        243    ,
-            
-        243    ,
-            
-        242    ,
-            
-        243    ,
-            
-        243    ,
-            
-        243    ,
-            
-        242    ,
-            
-        242    ,
-            
-        243    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        243    ,
-            
-        243    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        243    ,
-            
-        243    ,
-            
-        243    ,
-            
-        243    ,
-            
-        243    ,
-            
-        243    ,
-            
-        243    ,
-            
-        243    ,
-            
-        243    ,
-            
-        242    ,
-            
-        242    ,
-            
-        243    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        241    ,
-            
-        241    ,
-            
-        241    ,
-            
-        241    ,
-            
-        241    ,
-            
-        241    ,
-            
-        241    ,
-            
-        241    ,
-            
-        241    ,
-            
-        241    ,
-            
-        240    ,
-            
-        241    ,
-            
-        240    ,
-            
-        240    ,
-            
-        240    ,
-            
-        240    ,
-            
-        240    ,
-            
-        240    ,
-            
-        239    ,
-            
-        238    ,
-        239    ,
-            
-        238    ,
-            
-        238    ,
-            
-        237    ,
-            
-        236    ,
-            
-        236    ,
-            
-        235    ,
-            
-        236    ,
-            
-        236    ,
-            
-        234    ,
-            
-        234    ,
-            
-        234    ,
-            
-        233    ,
-            
-        232    ,
-            
-        232    ,
-            
-        232    ,
-            
-        231    ,
-            
-        231    ,
-            
-        231    ,
-            
-        230    ,
-            
-        229    ,
-            
-        230    ,
-            
-        228    ,
-            
-        228    ,
-            
-        227    ,
-            
-        227    ,
-            
-        226    ,
-            
-        225    ,
-            
-        225    ,
-            
-        224    ,
-            
-        224    ,
-            
-        224    ,
-            
-        223    ,
-            
-        223    ,
-            
-        222    ,
-            
-        222    ,
-            
-        221    ,
-            
-        221    ,
-            
-        220    ,
-            
-        220    ,
-            
-        219    ,
-            
-        218    ,
-            
-        217    ,
-            
-        217    ,
-            
-        217    ,
-            
-        216    ,
-            
-        216    ,
-            
-        215    ,
-            
-        214    ,
-            
-        213    ,
-            
-        212    ,
-            
-        211    ,
-            
-        211    ,
-            
-        210    ,
-            
-        209    ,
-            
-        209    ,
-            
-        208    ,
-            
-        207    ,
-            
-        207    ,
-            
-        205    ,
-            
-        206    ,
-            
-        204    ,
-            
-        203    ,
-            
-        202    ,
-            
-        201    ,
-            
-        200    ,
-            
-        200    ,
-            
-        199    ,
-            
-        198    ,
-            
-        196    ,
-            
-        195    ,
-            
-        193    ,
-            
-        192    ,
-            
-        190    ,
-            
-        189    ,
-            
-        186    ,
-            
-        185    ,
-            
-        182    ,
-            
-        177    ,
-            
-        168    ,
-            
-        158    ,
-            
-        141    ,
-            
-        119    ,
-            
-        120    ,
-            
-        128    ,
-            
-        133    ,
-            
-        139    ,
-            
-        142    ,
-            
-        147    ,
-            
-        151    ,
-            
-        135    ,
-            
-        121    ,
-            
-        133    ,
-            
-        146    ,
-            
-        144    ,
-            
-        131    ,
-            
-        118    ,
-            
-        127    ,
-            
-        131    ,
-            
-        136    ,
-            
-        139    ,
-            
-        141    ,
-            
-        145    ,
-            
-        150    ,
-            
-        134    ,
-            
-        119    ,
-            
-        122    ,
-            
-        125    ,
-            
-        131    ,
-            
-        134    ,
-            
-        137    ,
-            
-        141    ,
-            
-        145    ,
-            
-        147    ,
-            
-        148    ,
-            
-        130    ,
-            
-        109    ,
-            
-        139    ,
-            
-        147    ,
-            
-        148    ,
-            
-        128    ,
-            
-        122    ,
-            
-        113    ,
-            
-        126    ,
-            
-        131    ,
-            
-        134    ,
-            
-        138    ,
-            
-        141    ,
-            
-        142    ,
-            
-        147    ,
-            
-        149    ,
-            
-        149    ,
-            
-        126    ,
-            
-        98    ,
-            
-        137    ,
-            
-        155    ,
-            
-        139    ,
-            
-        121    ,
-            
-        119    ,
-            
-        123    ,
-            
-        126    ,
-            
-        126    ,
-            
-        131    ,
-            
-        134    ,
-            
-        138    ,
-            
-        140    ,
-            
-        141    ,
-            
-        142    ,
-            
-        144    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        144    ,
-            
-        148    ,
-            
-        148    ,
-            
-        145    ,
-            
-        121    ,
-            
-        99    ,
-            
-        100    ,
-            
-        100    ,
-            
-        101    ,
-            
-        100    ,
-            
-        101    ,
-            
-        101    ,
-            
-        101    ,
-            
-        102    ,
-            
-        103    ,
-            
-        102    ,
-            
-        102    ,
-            
-        103    ,
-            
-        103    ,
-            
-        102    ,
-            
-        102    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        104    ,
-            
-        104    ,
-            
-        103    ,
-            
-        103    ,
-            
-        104    ,
-            
-        105    ,
-            
-        105    ,
-            
-        104    ,
-            
-        104    ,
-            
-        104    ,
-            
-        104    ,
-            
-        106    ,
-            
-        106    ,
-            
-        105    ,
-            
-        104    ,
-            
-        104    ,
-            
-        104    ,
-            
-        107    ,
-            
-        106    ,
-            
-        105    ,
-            
-        105    ,
-            
-        105    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        108    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        109    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        123    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        148    ,
-            
-        147    ,
-            
-        149    ,
-            
-        146    ,
-            
-        147    ,
-            
-        148    ,
-            
-        146    ,
-            
-        147    ,
-            
-        148    ,
-            
-        149    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        147    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        147    ,
-            
-        148    ,
-            
-        147    ,
-            
-        148    ,
-            
-        149    ,
-            
-        136    ,
-            
-        116    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        127    ,
-            
-        128    ,
-            
-        127    ,
-            
-        127    ,
-            
-        129    ,
-            
-        130    ,
-            
-        131    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        136    ,
-            
-        136    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        141    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        146    ,
-            
-        121    ,
-            
-        104    ,
-            
-        104    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        126    ,
-            
-        129    ,
-            
-        133    ,
-            
-        136    ,
-            
-        139    ,
-            
-        143    ,
-            
-        146    ,
-            
-        149    ,
-            
-        146    ,
-            
-        125    ,
-            
-        110    ,
-            
-        113    ,
-            
-        119    ,
-            
-        123    ,
-            
-        126    ,
-            
-        129    ,
-            
-        132    ,
-            
-        134    ,
-            
-        136    ,
-            
-        137    ,
-            
-        139    ,
-            
-        141    ,
-            
-        142    ,
-            
-        144    ,
-            
-        147    ,
-            
-        148    ,
-            
-        150    ,
-            
-        143    ,
-            
-        122    ,
-            
-        109    ,
-            
-        112    ,
-            
-        120    ,
-            
-        127    ,
-            
-        133    ,
-            
-        139    ,
-            
-        145    ,
-            
-        150    ,
-            
-        137    ,
-            
-        120    ,
-            
-        100    ,
-            
-        114    ,
-            
-        124    ,
-            
-        131    ,
-            
-        137    ,
-            
-        143    ,
-            
-        147    ,
-            
-        145    ,
-            
-        131    ,
-            
-        117    ,
-            
-        126    ,
-            
-        131    ,
-            
-        136    ,
-            
-        140    ,
-            
-        143    ,
-            
-        148    ,
-            
-        141    ,
-            
-        121    ,
-            
-        118    ,
-            
-        125    ,
-            
-        130    ,
-            
-        136    ,
-            
-        137    ,
-            
-        143    ,
-            
-        145    ,
-            
-        149    ,
-            
-        140    ,
-            
-        120    ,
-            
-        119    ,
-            
-        123    ,
-            
-        126    ,
-            
-        130    ,
-            
-        134    ,
-            
-        137    ,
-            
-        140    ,
-            
-        143    ,
-            
-        145    ,
-            
-        148    ,
-            
-        144    ,
-            
-        124    ,
-            
-        91    ,
-            
-        104    ,
-            
-        109    ,
-            
-        113    ,
-            
-        119    ,
-            
-        124    ,
-            
-        128    ,
-            
-        133    ,
-            
-        136    ,
-            
-        140    ,
-            
-        144    ,
-            
-        147    ,
-            
-        150    ,
-            
-        133    ,
-            
-        116    ,
-            
-        105    ,
-            
-        112    ,
-            
-        113    ,
-            
-        123    ,
-            
-        127    ,
-            
-        130    ,
-            
-        134    ,
-            
-        139    ,
-            
-        141    ,
-            
-        144    ,
-            
-        148    ,
-            
-        144    ,
-            
-        123    ,
-            
-        100    ,
-            
-        109    ,
-            
-        112    ,
-            
-        112    ,
-            
-        123    ,
-            
-        127    ,
-            
-        130    ,
-            
-        134    ,
-            
-        136    ,
-            
-        140    ,
-            
-        142    ,
-            
-        144    ,
-            
-        147    ,
-            
-        149    ,
-            
-        144    ,
-            
-        122    ,
-            
-        110    ,
-            
-        115    ,
-            
-        115    ,
-            
-        122    ,
-            
-        126    ,
-            
-        129    ,
-            
-        133    ,
-            
-        136    ,
-            
-        138    ,
-            
-        143    ,
-            
-        145    ,
-            
-        149    ,
-            
-        145    ,
-            
-        127    ,
-            
-        112    ,
-            
-        121    ,
-            
-        125    ,
-            
-        130    ,
-            
-        136    ,
-            
-        140    ,
-            
-        144    ,
-            
-        148    ,
-            
-        147    ,
-            
-        132    ,
-            
-        107    ,
-            
-        111    ,
-            
-        111    ,
-            
-        124    ,
-            
-        131    ,
-            
-        135    ,
-            
-        141    ,
-            
-        147    ,
-            
-        148    ,
-            
-        137    ,
-            
-        119    ,
-            
-        128    ,
-            
-        140    ,
-            
-        151    ,
-            
-        141    ,
-            
-        128    ,
-            
-        119    ,
-            
-        131    ,
-            
-        141    ,
-            
-        149    ,
-            
-        139    ,
-            
-        123    ,
-            
-        122    ,
-            
-        133    ,
-            
-        140    ,
-            
-        147    ,
-            
-        150    ,
-            
-        135    ,
-            
-        119    ,
-            
-        125    ,
-            
-        131    ,
-            
-        139    ,
-            
-        143    ,
-            
-        148    ,
-            
-        146    ,
-            
-        125    ,
-            
-        103    ,
-            
-        115    ,
-            
-        124    ,
-            
-        132    ,
-            
-        136    ,
-            
-        141    ,
-            
-        145    ,
-            
-        148    ,
-            
-        148    ,
-            
-        130    ,
-            
-        106    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        122    ,
-            
-        125    ,
-            
-        128    ,
-            
-        132    ,
-            
-        134    ,
-            
-        136    ,
-            
-        138    ,
-            
-        140    ,
-            
-        142    ,
-            
-        144    ,
-            
-        146    ,
-            
-        148    ,
-            
-        144    ,
-            
-        124    ,
-            
-        109    ,
-            
-        111    ,
-            
-        117    ,
-            
-        123    ,
-            
-        127    ,
-            
-        131    ,
-            
-        135    ,
-            
-        138    ,
-            
-        141    ,
-            
-        144    ,
-            
-        147    ,
-            
-        150    ,
-            
-        144    ,
-            
-        125    ,
-            
-        110    ,
-            
-        111    ,
-            
-        115    ,
-            
-        125    ,
-            
-        132    ,
-            
-        138    ,
-            
-        143    ,
-            
-        150    ,
-            
-        139    ,
-            
-        125    ,
-            
-        124    ,
-            
-        134    ,
-            
-        144    ,
-            
-        151    ,
-            
-        140    ,
-            
-        127    ,
-            
-        122    ,
-            
-        133    ,
-            
-        145    ,
-            
-        149    ,
-            
-        135    ,
-            
-        123    ,
-            
-        122    ,
-            
-        134    ,
-            
-        142    ,
-            
-        149    ,
-            
-        140    ,
-            
-        122    ,
-            
-        116    ,
-            
-        126    ,
-            
-        135    ,
-            
-        142    ,
-            
-        147    ,
-            
-        148    ,
-            
-        130    ,
-            
-        118    ,
-            
-        126    ,
-            
-        133    ,
-            
-        139    ,
-            
-        145    ,
-            
-        149    ,
-            
-        143    ,
-            
-        123    ,
-            
-        111    ,
-            
-        118    ,
-            
-        126    ,
-            
-        133    ,
-            
-        136    ,
-            
-        142    ,
-            
-        148    ,
-            
-        147    ,
-            
-        130    ,
-            
-        118    ,
-            
-        121    ,
-            
-        127    ,
-            
-        132    ,
-            
-        137    ,
-            
-        141    ,
-            
-        145    ,
-            
-        150    ,
-            
-        137    ,
-            
-        122    ,
-            
-        110    ,
-            
-        113    ,
-            
-        124    ,
-            
-        128    ,
-            
-        133    ,
-            
-        137    ,
-            
-        140    ,
-            
-        143    ,
-            
-        147    ,
-            
-        149    ,
-            
-        138    ,
-            
-        109    ,
-            
-        111    ,
-            
-        113    ,
-            
-        115    ,
-            
-        123    ,
-            
-        127    ,
-            
-        130    ,
-            
-        131    ,
-            
-        135    ,
-            
-        135    ,
-            
-        140    ,
-            
-        141    ,
-            
-        143    ,
-            
-        146    ,
-            
-        147    ,
-            
-        149    ,
-            
-        138    ,
-            
-        118    ,
-            
-        129    ,
-            
-        139    ,
-            
-        153    ,
-            
-        151    ,
-            
-        152    ,
-            
-        153    ,
-            
-        159    ,
-            
-        164    ,
-            
-        172    ,
-            
-        178    ,
-            
-        180    ,
-            
-        183    ,
-            
-        185    ,
-            
-        189    ,
-            
-        190    ,
-            
-        193    ,
-            
-        195    ,
-            
-        195    ,
-            
-        197    ,
-            
-        199    ,
-            
-        202    ,
-            
-        202    ,
-            
-        203    ,
-            
-        205    ,
-            
-        206    ,
-            
-        206    ,
-            
-        207    ,
-            
-        208    ,
-            
-        208    ,
-            
-        208    ,
-            
-        208    ,
-            
-        209    ,
-            
-        209    ,
-            
-        209    ,
-            
-        210    ,
-            
-        210    ,
-            
-        209    ,
-            
-        210    ,
-            
-        209    ,
-            
-        210    ,
-            
-        209    ,
-            
-        210    ,
-            
-        210    ,
-            
-        210    ,
-            
-        209    ,
-            
-        210    ,
-            
-        210    ,
-            
-        210    ,
-            
-        212    ,
-            
-        210    ,
-            
-        211    ,
-            
-        212    ,
-            
-        212    ,
-            
-        214    ,
-            
-        214    ,
-            
-        214    ,
-            
-        214    ,
-            
-        215    ,
-            
-        215    ,
-            
-        216    ,
-            
-        217    ,
-            
-        217    ,
-            
-        217    ,
-            
-        219    ,
-            
-        219    ,
-            
-        220    ,
-            
-        220    ,
-            
-        222    ,
-            
-        222    ,
-            
-        224    ,
-            
-        223    ,
-            
-        225    ,
-            
-        225    ,
-            
-        226    ,
-            
-        226    ,
-            
-        227    ,
-            
-        228    ,
-            
-        228    ,
-            
-        229    ,
-            
-        230    ,
-            
-        228    ,
-            
-        231    ,
-            
-        232    ,
-            
-        233    ,
-            
-        234    ,
-            
-        234    ,
-            
-        234    ,
-            
-        236    ,
-            
-        236    ,
-            
-        239    ,
-            
-        238    ,
-            
-        238    ,
-            
-        240    ,
-            
-        240    ,
-            
-        241    ,
-            
-        242    ,
-            
-        242    ,
-            
-        243    ,
-            
-        243    ,
-            
-        244    ,
-            
-        244    ,
-            
-        245    ,
-            
-        246    ,
-            
-        247    ,
-            
-        249    ,
-            
-        249    ,
-            
-        249    ,
-            
-        250    ,
-            
-        251    ,
-            
-        252    ,
-            
-        253    ,
-            
-        253    ,
-            
-        255    ,
-            
-        255    ,
-            
-        256    ,
-            
-        256    ,
-            
-        256    ,
-            
-        257    ,
-            
-        258    ,
-            
-        258    ,
-            
-        258    ,
-            
-        259    ,
-            
-        258    ,
-            
-        259    ,
-            
-        259    ,
-            
-        259    ,
-            
-        259    ,
-            
-        259    ,
-            
-        259    ,
-            
-        259    ,
-            
-        259    ,
-            
-        260    ,
-            
-        260    ,
-            
-        259    ,
-            
-        259    ,
-            
-        260    ,
-            
-        260    ,
-            
-        260    ,
-            
-        260    ,
-            
-        260    ,
-            
-        260    ,
-            
-        260    ,
-            
-        261    ,
-            
-        260    ,
-            
-        261    ,
-            
-        261    ,
-            
-        261    ,
-            
-        261    ,
-            
-        260    ,
-            
-        261    ,
-            
-        261    ,
-            
-        261    ,
-            
-        261    ,
-            
-        262    ,
-            
-        262    ,
-            
-        261    ,
-            
-        261    ,
-            
-        261    ,
-            
-        261    ,
-            
-        261    ,
-            
-        261    ,
-            
-        262    ,
-            
-        263    ,
-            
-        262    ,
-            
-        262    ,
-            
-        262    ,
-            
-        263    ,
-            
-        262    ,
-            
-        263    ,
-            
-        263    ,
-            
-        263    ,
-            
-        264    ,
-            
-        264    ,
-            
-        264    ,
-            
-        264    ,
-            
-        263    ,
-            
-        264    ,
-            
-        264    ,
-            
-        264    ,
-            
-        264    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        265    ,
-            
-        266    ,
-            
-        266    ,
-            
-        265    ,
-            
-        265    ,
-            
-        264    ,
-            
-        264    ,
-            
-        264    ,
-            
-        264    ,
-            
-        264    ,
-            
-        263    ,
-            
-        263    ,
-            
-        263    ,
-            
-        263    ,
-            
-        262    ,
-            
-        261    ,
-            
-        261    ,
-            
-        260    ,
-            
-        260    ,
-            
-        260    ,
-            
-        260    ,
-            
-        258    ,
-            
-        258    ,
-            
-        259    ,
-            
-        258    ,
-            
-        257    ,
-            
-        258    ,
-            
-        257    ,
-            
-        257    ,
-            
-        257    ,
-            
-        256    ,
-            
-        256    ,
-            
-        256    ,
-            
-        255    ,
-            
-        255    ,
-            
-        255    ,
-            
-        254    ,
-            
-        253    ,
-            
-        252    ,
-            
-        253    ,
-            
-        252    ,
-            
-        252    ,
-            
-        252    ,
-            
-        251    ,
-            
-        250    ,
-            
-        250    ,
-            
-        250    ,
-            
-        250    ,
-            
-        249    ,
-            
-        249    ,
-            
-        248    ,
-            
-        248    ,
-            
-        248    ,
-            
-        248    ,
-            
-        247    ,
-            
-        247    ,
-            
-        246    ,
-            
-        245    ,
-            
-        245    ,
-            
-        245    ,
-            
-        245    ,
-            
-        245    ,
-            
-        244    ,
-            
-        243    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        241    ,
-            
-        242    ,
-            
-        241    ,
-            
-        240    ,
-            
-        240    ,
-            
-        240    ,
-            
-        239    ,
-            
-        239    ,
-            
-        238    ,
-            
-        238    ,
-            
-        238    ,
-            
-        237    ,
-            
-        236    ,
-            
-        236    ,
-            
-        236    ,
-            
-        235    ,
-            
-        234    ,
-            
-        232    ,
-            
-        233    ,
-            
-        233    ,
-            
-        233    ,
-            
-        232    ,
-            
-        231    ,
-            
-        231    ,
-            
-        231    ,
-            
-        230    ,
-            
-        230    ,
-            
-        229    ,
-            
-        228    ,
-            
-        228    ,
-            
-        228    ,
-            
-        227    ,
-            
-        226    ,
-            
-        227    ,
-            
-        225    ,
-            
-        225    ,
-            
-        224    ,
-            
-        224    ,
-            
-        223    ,
-            
-        223    ,
-            
-        222    ,
-            
-        222    ,
-            
-        221    ,
-            
-        221    ,
-            
-        219    ,
-            
-        219    ,
-            
-        219    ,
-            
-        218    ,
-            
-        217    ,
-            
-        216    ,
-            
-        216    ,
-            
-        216    ,
-            
-        215    ,
-            
-        213    ,
-            
-        213    ,
-            
-        213    ,
-            
-        212    ,
-            
-        210    ,
-            
-        210    ,
-            
-        209    ,
-            
-        208    ,
-            
-        208    ,
-            
-        207    ,
-            
-        207    ,
-            
-        206    ,
-            
-        205    ,
-            
-        202    ,
-            
-        202    ,
-            
-        202    ,
-            
-        201    ,
-            
-        200    ,
-            
-        199    ,
-            
-        197    ,
-            
-        196    ,
-            
-        194    ,
-            
-        193    ,
-            
-        192    ,
-            
-        191    ,
-            
-        189    ,
-            
-        187    ,
-            
-        183    ,
-            
-        181    ,
-            
-        177    ,
-            
-        171    ,
-            
-        160    ,
-            
-        148    ,
-            
-        132    ,
-            
-        120    ,
-            
-        97    ,
-            
-        159    ,
-            
-        153    ,
-            
-        141    ,
-            
-        126    ,
-            
-        138    ,
-            
-        150    ,
-            
-        139    ,
-            
-        123    ,
-            
-        123    ,
-            
-        135    ,
-            
-        142    ,
-            
-        151    ,
-            
-        141    ,
-            
-        126    ,
-            
-        122    ,
-            
-        136    ,
-            
-        144    ,
-            
-        149    ,
-            
-        138    ,
-            
-        123    ,
-            
-        125    ,
-            
-        139    ,
-            
-        148    ,
-            
-        144    ,
-            
-        135    ,
-            
-        125    ,
-            
-        126    ,
-            
-        140    ,
-            
-        151    ,
-            
-        144    ,
-            
-        137    ,
-            
-        127    ,
-            
-        125    ,
-            
-        140    ,
-            
-        151    ,
-            
-        147    ,
-            
-        136    ,
-            
-        128    ,
-            
-        118    ,
-            
-        138    ,
-            
-        152    ,
-            
-        149    ,
-            
-        144    ,
-            
-        139    ,
-            
-        135    ,
-            
-        128    ,
-            
-        122    ,
-            
-        135    ,
-            
-        151    ,
-            
-        150    ,
-            
-        144    ,
-            
-        139    ,
-            
-        134    ,
-            
-        127    ,
-            
-        119    ,
-            
-        139    ,
-            
-        151    ,
-            
-        149    ,
-            
-        144    ,
-            
-        138    ,
-            
-        134    ,
-            
-        127    ,
-            
-        120    ,
-            
-        141    ,
-            
-        152    ,
-            
-        149    ,
-            
-        145    ,
-            
-        138    ,
-            
-        133    ,
-            
-        126    ,
-            
-        121    ,
-            
-        138    ,
-            
-        151    ,
-            
-        149    ,
-            
-        145    ,
-            
-        140    ,
-            
-        135    ,
-            
-        128    ,
-            
-        123    ,
-            
-        129    ,
-            
-        148    ,
-            
-        148    ,
-            
-        145    ,
-            
-        140    ,
-            
-        135    ,
-            
-        131    ,
-            
-        125    ,
-            
-        121    ,
-            
-        121    ,
-            
-        119    ,
-            
-        149    ,
-            
-        151    ,
-            
-        151    ,
-            
-        149    ,
-            
-        144    ,
-            
-        140    ,
-            
-        138    ,
-            
-        134    ,
-            
-        130    ,
-            
-        126    ,
-            
-        147    ,
-            
-        145    ,
-            
-        143    ,
-            
-        142    ,
-            
-        139    ,
-            
-        138    ,
-            
-        134    ,
-            
-        130    ,
-            
-        125    ,
-            
-        143    ,
-            
-        149    ,
-            
-        145    ,
-            
-        141    ,
-            
-        141    ,
-            
-        138    ,
-            
-        135    ,
-            
-        130    ,
-            
-        127    ,
-            
-        124    ,
-            
-        120    ,
-            
-        121    ,
-            
-        120    ,
-            
-        101    ,
-            
-        135    ,
-            
-        153    ,
-            
-        151    ,
-            
-        146    ,
-            
-        143    ,
-            
-        138    ,
-            
-        134    ,
-            
-        130    ,
-            
-        123    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        116    ,
-            
-        149    ,
-            
-        154    ,
-            
-        150    ,
-            
-        145    ,
-            
-        141    ,
-            
-        138    ,
-            
-        134    ,
-            
-        130    ,
-            
-        125    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        97    ,
-            
-        135    ,
-            
-        151    ,
-            
-        151    ,
-            
-        147    ,
-            
-        144    ,
-            
-        139    ,
-            
-        134    ,
-            
-        128    ,
-            
-        122    ,
-            
-        128    ,
-            
-        147    ,
-            
-        149    ,
-            
-        144    ,
-            
-        140    ,
-            
-        133    ,
-            
-        125    ,
-            
-        126    ,
-            
-        140    ,
-            
-        155    ,
-            
-        147    ,
-            
-        144    ,
-            
-        136    ,
-            
-        131    ,
-            
-        123    ,
-            
-        123    ,
-            
-        97    ,
-            
-        109    ,
-            
-        146    ,
-            
-        152    ,
-            
-        146    ,
-            
-        140    ,
-            
-        134    ,
-            
-        125    ,
-            
-        120    ,
-            
-        120    ,
-            
-        96    ,
-            
-        138    ,
-            
-        152    ,
-            
-        150    ,
-            
-        144    ,
-            
-        140    ,
-            
-        133    ,
-            
-        128    ,
-            
-        123    ,
-            
-        123    ,
-            
-        142    ,
-            
-        153    ,
-            
-        150    ,
-            
-        145    ,
-            
-        142    ,
-            
-        139    ,
-            
-        133    ,
-            
-        130    ,
-            
-        127    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        102    ,
-            
-        112    ,
-            
-        147    ,
-            
-        151    ,
-            
-        149    ,
-            
-        142    ,
-            
-        138    ,
-            
-        132    ,
-            
-        123    ,
-            
-        120    ,
-            
-        120    ,
-            
-        97    ,
-            
-        137    ,
-            
-        151    ,
-            
-        148    ,
-            
-        141    ,
-            
-        134    ,
-            
-        126    ,
-            
-        121    ,
-            
-        121    ,
-            
-        98    ,
-            
-        141    ,
-            
-        153    ,
-            
-        147    ,
-            
-        141    ,
-            
-        132    ,
-            
-        124    ,
-            
-        125    ,
-            
-        140    ,
-            
-        152    ,
-            
-        148    ,
-            
-        139    ,
-            
-        132    ,
-            
-        122    ,
-            
-        127    ,
-            
-        144    ,
-            
-        151    ,
-            
-        143    ,
-            
-        137    ,
-            
-        125    ,
-            
-        123    ,
-            
-        138    ,
-            
-        152    ,
-            
-        147    ,
-            
-        136    ,
-            
-        127    ,
-            
-        125    ,
-            
-        139    ,
-            
-        151    ,
-            
-        147    ,
-            
-        134    ,
-            
-        122    ,
-            
-        128    ,
-            
-        144    ,
-            
-        149    ,
-            
-        139    ,
-            
-        131    ,
-            
-        119    ,
-            
-        133    ,
-            
-        147    ,
-            
-        151    ,
-            
-        139    ,
-            
-        129    ,
-            
-        118    ,
-            
-        133    ,
-            
-        146    ,
-            
-        149    ,
-            
-        140    ,
-            
-        126    ,
-            
-        125    ,
-            
-        140    ,
-            
-        148    ,
-            
-        144    ,
-            
-        135    ,
-            
-        122    ,
-            
-        120    ,
-            
-        109    ,
-            
-        132    ,
-            
-        143    ,
-            
-        150    ,
-            
-        141    ,
-            
-        131    ,
-            
-        117    ,
-            
-        133    ,
-            
-        143    ,
-            
-        151    ,
-            
-        143    ,
-            
-        133    ,
-            
-        122    ,
-            
-        131    ,
-            
-        143    ,
-            
-        153    ,
-            
-        144    ,
-            
-        134    ,
-            
-        123    ,
-            
-        125    ,
-            
-        143    ,
-            
-        150    ,
-            
-        141    ,
-            
-        133    ,
-            
-        119    ,
-            
-        127    ,
-            
-        144    ,
-            
-        150    ,
-            
-        141    ,
-            
-        130    ,
-            
-        119    ,
-            
-        136    ,
-            
-        149    ,
-            
-        148    ,
-            
-        139    ,
-            
-        126    ,
-            
-        124    ,
-            
-        138    ,
-            
-        151    ,
-            
-        145    ,
-            
-        138    ,
-            
-        124    ,
-            
-        121    ,
-            
-        93    ,
-            
-        125    ,
-            
-        141    ,
-            
-        149    ,
-            
-        140    ,
-            
-        132    ,
-            
-        119    ,
-            
-        132    ,
-            
-        144    ,
-            
-        150    ,
-            
-        140    ,
-            
-        132    ,
-            
-        119    ,
-            
-        135    ,
-            
-        147    ,
-            
-        147    ,
-            
-        139    ,
-            
-        126    ,
-            
-        124    ,
-            
-        138    ,
-            
-        151    ,
-            
-        145    ,
-            
-        135    ,
-            
-        125    ,
-            
-        125    ,
-            
-        142    ,
-            
-        150    ,
-            
-        143    ,
-            
-        134    ,
-            
-        122    ,
-            
-        127    ,
-            
-        144    ,
-            
-        150    ,
-            
-        141    ,
-            
-        133    ,
-            
-        122    ,
-            
-        131    ,
-            
-        144    ,
-            
-        152    ,
-            
-        139    ,
-            
-        131    ,
-            
-        120    ,
-            
-        135    ,
-            
-        145    ,
-            
-        147    ,
-            
-        139    ,
-            
-        128    ,
-            
-        119    ,
-            
-        137    ,
-            
-        151    ,
-            
-        145    ,
-            
-        138    ,
-            
-        126    ,
-            
-        122    ,
-            
-        136    ,
-            
-        150    ,
-            
-        145    ,
-            
-        136    ,
-            
-        124    ,
-            
-        125    ,
-            
-        140    ,
-            
-        152    ,
-            
-        146    ,
-            
-        134    ,
-            
-        125    ,
-            
-        126    ,
-            
-        142    ,
-            
-        149    ,
-            
-        141    ,
-            
-        133    ,
-            
-        119    ,
-            
-        133    ,
-            
-        146    ,
-            
-        152    ,
-            
-        140    ,
-            
-        130    ,
-            
-        120    ,
-            
-        136    ,
-            
-        146    ,
-            
-        147    ,
-            
-        140    ,
-            
-        131    ,
-            
-        119    ,
-            
-        133    ,
-            
-        148    ,
-            
-        147    ,
-            
-        141    ,
-            
-        130    ,
-            
-        122    ,
-            
-        129    ,
-            
-        145    ,
-            
-        151    ,
-            
-        142    ,
-            
-        134    ,
-            
-        124    ,
-            
-        126    ,
-            
-        142    ,
-            
-        151    ,
-            
-        145    ,
-            
-        136    ,
-            
-        126    ,
-            
-        122    ,
-            
-        139    ,
-            
-        151    ,
-            
-        147    ,
-            
-        138    ,
-            
-        129    ,
-            
-        117    ,
-            
-        136    ,
-            
-        148    ,
-            
-        146    ,
-            
-        141    ,
-            
-        130    ,
-            
-        120    ,
-            
-        132    ,
-            
-        145    ,
-            
-        151    ,
-            
-        141    ,
-            
-        133    ,
-            
-        122    ,
-            
-        132    ,
-            
-        146    ,
-            
-        151    ,
-            
-        142    ,
-            
-        134    ,
-            
-        120    ,
-            
-        134    ,
-            
-        147    ,
-            
-        149    ,
-            
-        141    ,
-            
-        128    ,
-            
-        120    ,
-            
-        133    ,
-            
-        148    ,
-            
-        150    ,
-            
-        140    ,
-            
-        127    ,
-            
-        123    ,
-            
-        138    ,
-            
-        149    ,
-            
-        146    ,
-            
-        136    ,
-            
-        126    ,
-            
-        116    ,
-            
-        134    ,
-            
-        146    ,
-            
-        149    ,
-            
-        140    ,
-            
-        128    ,
-            
-        119    ,
-            
-        135    ,
-            
-        150    ,
-            
-        148    ,
-            
-        140    ,
-            
-        128    ,
-            
-        118    ,
-            
-        134    ,
-            
-        147    ,
-            
-        145    ,
-            
-        138    ,
-            
-        124    ,
-            
-        125    ,
-            
-        140    ,
-            
-        151    ,
-            
-        144    ,
-            
-        133    ,
-            
-        122    ,
-            
-        128    ,
-            
-        144    ,
-            
-        150    ,
-            
-        139    ,
-            
-        132    ,
-            
-        119    ,
-            
-        135    ,
-            
-        147    ,
-            
-        150    ,
-            
-        138    ,
-            
-        126    ,
-            
-        122    ,
-            
-        136    ,
-            
-        151    ,
-            
-        145    ,
-            
-        136    ,
-            
-        126    ,
-            
-        126    ,
-            
-        138    ,
-            
-        151    ,
-            
-        146    ,
-            
-        134    ,
-            
-        125    ,
-            
-        125    ,
-            
-        140    ,
-            
-        150    ,
-            
-        146    ,
-            
-        134    ,
-            
-        126    ,
-            
-        124    ,
-            
-        140    ,
-            
-        152    ,
-            
-        148    ,
-            
-        137    ,
-            
-        128    ,
-            
-        119    ,
-            
-        136    ,
-            
-        151    ,
-            
-        147    ,
-            
-        140    ,
-            
-        131    ,
-            
-        119    ,
-            
-        136    ,
-            
-        148    ,
-            
-        148    ,
-            
-        141    ,
-            
-        131    ,
-            
-        122    ,
-            
-        121    ,
-            
-        76    ,
-            
-        118    ,
-            
-        144    ,
-            
-        151    ,
-            
-        144    ,
-            
-        137    ,
-            
-        127    ,
-            
-        121    ,
-            
-        138    ,
-            
-        150    ,
-            
-        148    ,
-            
-        142    ,
-            
-        132    ,
-            
-        122    ,
-            
-        133    ,
-            
-        146    ,
-            
-        151    ,
-            
-        142    ,
-            
-        136    ,
-            
-        125    ,
-            
-        127    ,
-            
-        139    ,
-            
-        152    ,
-            
-        146    ,
-            
-        137    ,
-            
-        126    ,
-            
-        120    ,
-            
-        138    ,
-            
-        150    ,
-            
-        147    ,
-            
-        140    ,
-            
-        131    ,
-            
-        120    ,
-            
-        131    ,
-            
-        147    ,
-            
-        148    ,
-            
-        141    ,
-            
-        134    ,
-            
-        123    ,
-            
-        130    ,
-            
-        149    ,
-            
-        149    ,
-            
-        142    ,
-            
-        138    ,
-            
-        128    ,
-            
-        120    ,
-            
-        136    ,
-            
-        150    ,
-            
-        146    ,
-            
-        140    ,
-            
-        129    ,
-            
-        120    ,
-            
-        136    ,
-            
-        148    ,
-            
-        146    ,
-            
-        140    ,
-            
-        128    ,
-            
-        123    ,
-            
-        136    ,
-            
-        149    ,
-            
-        146    ,
-            
-        140    ,
-            
-        127    ,
-            
-        121    ,
-            
-        97    ,
-            
-        103    ,
-            
-        138    ,
-            
-        151    ,
-            
-        147    ,
-            
-        135    ,
-            
-        127    ,
-            
-        126    ,
-            
-        138    ,
-            
-        152    ,
-            
-        147    ,
-            
-        136    ,
-            
-        124    ,
-            
-        127    ,
-            
-        141    ,
-            
-        150    ,
-            
-        145    ,
-            
-        135    ,
-            
-        125    ,
-            
-        128    ,
-            
-        144    ,
-            
-        150    ,
-            
-        141    ,
-            
-        134    ,
-            
-        122    ,
-            
-        133    ,
-            
-        146    ,
-            
-        150    ,
-            
-        142    ,
-            
-        134    ,
-            
-        122    ,
-            
-        128    ,
-            
-        145    ,
-            
-        152    ,
-            
-        144    ,
-            
-        138    ,
-            
-        125    ,
-            
-        116    ,
-            
-        136    ,
-            
-        148    ,
-            
-        148    ,
-            
-        142    ,
-            
-        130    ,
-            
-        120    ,
-            
-        133    ,
-            
-        146    ,
-            
-        149    ,
-            
-        142    ,
-            
-        134    ,
-            
-        122    ,
-            
-        130    ,
-            
-        144    ,
-            
-        148    ,
-            
-        139    ,
-            
-        130    ,
-            
-        119    ,
-            
-        135    ,
-            
-        149    ,
-            
-        149    ,
-            
-        140    ,
-            
-        126    ,
-            
-        120    ,
-            
-        135    ,
-            
-        148    ,
-            
-        147    ,
-            
-        140    ,
-            
-        126    ,
-            
-        123    ,
-            
-        136    ,
-            
-        150    ,
-            
-        145    ,
-            
-        133    ,
-            
-        122    ,
-            
-        128    ,
-            
-        143    ,
-            
-        151    ,
-            
-        144    ,
-            
-        133    ,
-            
-        118    ,
-            
-        133    ,
-            
-        143    ,
-            
-        152    ,
-            
-        145    ,
-            
-        132    ,
-            
-        119    ,
-            
-        127    ,
-            
-        141    ,
-            
-        152    ,
-            
-        144    ,
-            
-        131    ,
-            
-        119    ,
-            
-        134    ,
-            
-        141    ,
-            
-        150    ,
-            
-        143    ,
-            
-        127    ,
-            
-        124    ,
-            
-        134    ,
-            
-        147    ,
-            
-        150    ,
-            
-        139    ,
-            
-        125    ,
-            
-        125    ,
-            
-        139    ,
-            
-        148    ,
-            
-        145    ,
-            
-        135    ,
-            
-        121    ,
-            
-        124    ,
-            
-        140    ,
-            
-        149    ,
-            
-        144    ,
-            
-        136    ,
-            
-        120    ,
-            
-        128    ,
-            
-        141    ,
-            
-        152    ,
-            
-        142    ,
-            
-        131    ,
-            
-        119    ,
-            
-        134    ,
-            
-        146    ,
-            
-        149    ,
-            
-        142    ,
-            
-        127    ,
-            
-        112    ,
-            
-        129    ,
-            
-        142    ,
-            
-        149    ,
-            
-        142    ,
-            
-        128    ,
-            
-        115    ,
-            
-        131    ,
-            
-        143    ,
-            
-        149    ,
-            
-        141    ,
-            
-        127    ,
-            
-        119    ,
-            
-        133    ,
-            
-        145    ,
-            
-        149    ,
-            
-        139    ,
-            
-        123    ,
-            
-        124    ,
-            
-        136    ,
-            
-        148    ,
-            
-        145    ,
-            
-        134    ,
-            
-        120    ,
-            
-        128    ,
-            
-        140    ,
-            
-        152    ,
-            
-        142    ,
-            
-        133    ,
-            
-        121    ,
-            
-        133    ,
-            
-        142    ,
-            
-        152    ,
-            
-        143    ,
-            
-        126    ,
-            
-        123    ,
-            
-        134    ,
-            
-        146    ,
-            
-        150    ,
-            
-        137    ,
-            
-        122    ,
-            
-        123    ,
-            
-        138    ,
-            
-        147    ,
-            
-        148    ,
-            
-        135    ,
-            
-        120    ,
-            
-        127    ,
-            
-        140    ,
-            
-        149    ,
-            
-        143    ,
-            
-        131    ,
-            
-        116    ,
-            
-        129    ,
-            
-        137    ,
-            
-        147    ,
-            
-        149    ,
-            
-        134    ,
-            
-        119    ,
-            
-        123    ,
-            
-        135    ,
-            
-        147    ,
-            
-        150    ,
-            
-        135    ,
-            
-        123    ,
-            
-        123    ,
-            
-        136    ,
-            
-        145    ,
-            
-        150    ,
-            
-        138    ,
-            
-        123    ,
-            
-        123    ,
-            
-        136    ,
-            
-        145    ,
-            
-        149    ,
-            
-        136    ,
-            
-        119    ,
-            
-        129    ,
-            
-        138    ,
-            
-        149    ,
-            
-        148    ,
-            
-        134    ,
-            
-        122    ,
-            
-        120    ,
-            
-        136    ,
-            
-        144    ,
-            
-        150    ,
-            
-        141    ,
-            
-        124    ,
-            
-        123    ,
-            
-        136    ,
-            
-        144    ,
-            
-        150    ,
-            
-        140    ,
-            
-        122    ,
-            
-        126    ,
-            
-        137    ,
-            
-        145    ,
-            
-        149    ,
-            
-        141    ,
-            
-        123    ,
-            
-        123    ,
-            
-        135    ,
-            
-        143    ,
-            
-        152    ,
-            
-        140    ,
-            
-        123    ,
-            
-        124    ,
-            
-        137    ,
-            
-        145    ,
-            
-        153    ,
-            
-        141    ,
-            
-        125    ,
-            
-        120    ,
-            
-        134    ,
-            
-        144    ,
-            
-        152    ,
-            
-        140    ,
-            
-        125    ,
-            
-        122    ,
-            
-        135    ,
-            
-        143    ,
-            
-        150    ,
-            
-        141    ,
-            
-        124    ,
-            
-        122    ,
-            
-        135    ,
-            
-        143    ,
-            
-        150    ,
-            
-        141    ,
-            
-        124    ,
-            
-        125    ,
-            
-        134    ,
-            
-        144    ,
-            
-        150    ,
-            
-        140    ,
-            
-        122    ,
-            
-        122    ,
-            
-        136    ,
-            
-        143    ,
-            
-        151    ,
-            
-        141    ,
-            
-        123    ,
-            
-        120    ,
-            
-        135    ,
-            
-        141    ,
-            
-        150    ,
-            
-        141    ,
-            
-        128    ,
-            
-        122    ,
-            
-        135    ,
-            
-        141    ,
-            
-        152    ,
-            
-        141    ,
-            
-        127    ,
-            
-        126    ,
-            
-        135    ,
-            
-        145    ,
-            
-        152    ,
-            
-        140    ,
-            
-        122    ,
-            
-        120    ,
-            
-        134    ,
-            
-        141    ,
-            
-        150    ,
-            
-        139    ,
-            
-        122    ,
-            
-        126    ,
-            
-        137    ,
-            
-        144    ,
-            
-        150    ,
-            
-        139    ,
-            
-        120    ,
-            
-        126    ,
-            
-        135    ,
-            
-        145    ,
-            
-        149    ,
-            
-        137    ,
-            
-        118    ,
-            
-        130    ,
-            
-        138    ,
-            
-        147    ,
-            
-        148    ,
-            
-        139    ,
-            
-        118    ,
-            
-        128    ,
-            
-        137    ,
-            
-        147    ,
-            
-        146    ,
-            
-        132    ,
-            
-        120    ,
-            
-        131    ,
-            
-        139    ,
-            
-        148    ,
-            
-        147    ,
-            
-        130    ,
-            
-        121    ,
-            
-        130    ,
-            
-        140    ,
-            
-        147    ,
-            
-        147    ,
-            
-        130    ,
-            
-        121    ,
-            
-        131    ,
-            
-        141    ,
-            
-        148    ,
-            
-        147    ,
-            
-        131    ,
-            
-        121    ,
-            
-        129    ,
-            
-        141    ,
-            
-        147    ,
-            
-        145    ,
-            
-        130    ,
-            
-        122    ,
-            
-        130    ,
-            
-        140    ,
-            
-        147    ,
-            
-        147    ,
-            
-        130    ,
-            
-        121    ,
-            
-        130    ,
-            
-        140    ,
-            
-        147    ,
-            
-        143    ,
-            
-        130    ,
-            
-        122    ,
-            
-        132    ,
-            
-        142    ,
-            
-        148    ,
-            
-        143    ,
-            
-        128    ,
-            
-        114    ,
-            
-        125    ,
-            
-        133    ,
-            
-        142    ,
-            
-        149    ,
-            
-        140    ,
-            
-        127    ,
-            
-        118    ,
-            
-        128    ,
-            
-        139    ,
-            
-        147    ,
-            
-        147    ,
-            
-        132    ,
-            
-        118    ,
-            
-        129    ,
-            
-        138    ,
-            
-        145    ,
-            
-        146    ,
-            
-        127    ,
-            
-        113    ,
-            
-        125    ,
-            
-        134    ,
-            
-        143    ,
-            
-        151    ,
-            
-        139    ,
-            
-        123    ,
-            
-        122    ,
-            
-        135    ,
-            
-        140    ,
-            
-        149    ,
-            
-        145    ,
-            
-        128    ,
-            
-        120    ,
-            
-        129    ,
-            
-        138    ,
-            
-        147    ,
-            
-        148    ,
-            
-        133    ,
-            
-        118    ,
-            
-        129    ,
-            
-        136    ,
-            
-        144    ,
-            
-        149    ,
-            
-        136    ,
-            
-        117    ,
-            
-        128    ,
-            
-        135    ,
-            
-        144    ,
-            
-        152    ,
-            
-        142    ,
-            
-        129    ,
-            
-        121    ,
-            
-        130    ,
-            
-        139    ,
-            
-        147    ,
-            
-        147    ,
-            
-        135    ,
-            
-        118    ,
-            
-        129    ,
-            
-        136    ,
-            
-        145    ,
-            
-        150    ,
-            
-        137    ,
-            
-        119    ,
-            
-        127    ,
-            
-        135    ,
-            
-        141    ,
-            
-        150    ,
-            
-        141    ,
-            
-        125    ,
-            
-        121    ,
-            
-        129    ,
-            
-        140    ,
-            
-        149    ,
-            
-        145    ,
-            
-        127    ,
-            
-        121    ,
-            
-        130    ,
-            
-        140    ,
-            
-        146    ,
-            
-        147    ,
-            
-        133    ,
-            
-        118    ,
-            
-        128    ,
-            
-        138    ,
-            
-        145    ,
-            
-        148    ,
-            
-        138    ,
-            
-        118    ,
-            
-        128    ,
-            
-        135    ,
-            
-        144    ,
-            
-        148    ,
-            
-        133    ,
-            
-        120    ,
-            
-        123    ,
-            
-        134    ,
-            
-        142    ,
-            
-        149    ,
-            
-        145    ,
-            
-        126    ,
-            
-        121    ,
-            
-        130    ,
-            
-        141    ,
-            
-        146    ,
-            
-        148    ,
-            
-        136    ,
-            
-        115    ,
-            
-        127    ,
-            
-        136    ,
-            
-        145    ,
-            
-        148    ,
-            
-        136    ,
-            
-        118    ,
-            
-        129    ,
-            
-        136    ,
-            
-        145    ,
-            
-        149    ,
-            
-        138    ,
-            
-        115    ,
-            
-        128    ,
-            
-        135    ,
-            
-        144    ,
-            
-        150    ,
-            
-        139    ,
-            
-        121    ,
-            
-        126    ,
-            
-        136    ,
-            
-        143    ,
-            
-        149    ,
-            
-        140    ,
-            
-        124    ,
-            
-        122    ,
-            
-        135    ,
-            
-        142    ,
-            
-        151    ,
-            
-        137    ,
-            
-        120    ,
-            
-        125    ,
-            
-        136    ,
-            
-        144    ,
-            
-        148    ,
-            
-        135    ,
-            
-        120    ,
-            
-        128    ,
-            
-        137    ,
-            
-        144    ,
-            
-        150    ,
-            
-        141    ,
-            
-        126    ,
-            
-        122    ,
-            
-        134    ,
-            
-        141    ,
-            
-        150    ,
-            
-        139    ,
-            
-        122    ,
-            
-        123    ,
-            
-        134    ,
-            
-        141    ,
-            
-        149    ,
-            
-        145    ,
-            
-        128    ,
-            
-        121    ,
-            
-        130    ,
-            
-        139    ,
-            
-        146    ,
-            
-        150    ,
-            
-        137    ,
-            
-        117    ,
-            
-        126    ,
-            
-        135    ,
-            
-        141    ,
-            
-        147    ,
-            
-        141    ,
-            
-        126    ,
-            
-        120    ,
-            
-        128    ,
-            
-        139    ,
-            
-        144    ,
-            
-        148    ,
-            
-        138    ,
-            
-        118    ,
-            
-        128    ,
-            
-        135    ,
-            
-        144    ,
-            
-        149    ,
-            
-        139    ,
-            
-        125    ,
-            
-        121    ,
-            
-        131    ,
-            
-        139    ,
-            
-        145    ,
-            
-        148    ,
-            
-        133    ,
-            
-        115    ,
-            
-        126    ,
-            
-        133    ,
-            
-        141    ,
-            
-        147    ,
-            
-        147    ,
-            
-        131    ,
-            
-        119    ,
-            
-        128    ,
-            
-        137    ,
-            
-        144    ,
-            
-        152    ,
-            
-        138    ,
-            
-        120    ,
-            
-        116    ,
-            
-        127    ,
-            
-        135    ,
-            
-        144    ,
-            
-        148    ,
-            
-        142    ,
-            
-        126    ,
-            
-        118    ,
-            
-        127    ,
-            
-        138    ,
-            
-        144    ,
-            
-        150    ,
-            
-        136    ,
-            
-        119    ,
-            
-        116    ,
-            
-        131    ,
-            
-        138    ,
-            
-        145    ,
-            
-        148    ,
-            
-        135    ,
-            
-        115    ,
-            
-        125    ,
-            
-        132    ,
-            
-        142    ,
-            
-        148    ,
-            
-        148    ,
-            
-        128    ,
-            
-        119    ,
-            
-        128    ,
-            
-        135    ,
-            
-        143    ,
-            
-        150    ,
-            
-        135    ,
-            
-        120    ,
-            
-        100    ,
-            
-        115    ,
-            
-        127    ,
-            
-        135    ,
-            
-        142    ,
-            
-        148    ,
-            
-        144    ,
-            
-        126    ,
-            
-        120    ,
-            
-        127    ,
-            
-        137    ,
-            
-        143    ,
-            
-        149    ,
-            
-        148    ,
-            
-        130    ,
-            
-        119    ,
-            
-        127    ,
-            
-        137    ,
-            
-        143    ,
-            
-        150    ,
-            
-        139    ,
-            
-        121    ,
-            
-        116    ,
-            
-        126    ,
-            
-        136    ,
-            
-        143    ,
-            
-        149    ,
-            
-        142    ,
-            
-        125    ,
-            
-        110    ,
-            
-        120    ,
-            
-        128    ,
-            
-        137    ,
-            
-        143    ,
-            
-        150    ,
-            
-        145    ,
-            
-        124    ,
-            
-        122    ,
-            
-        130    ,
-            
-        138    ,
-            
-        145    ,
-            
-        150    ,
-            
-        135    ,
-            
-        118    ,
-            
-        123    ,
-            
-        131    ,
-            
-        138    ,
-            
-        144    ,
-            
-        151    ,
-            
-        139    ,
-            
-        121    ,
-            
-        122    ,
-            
-        132    ,
-            
-        139    ,
-            
-        146    ,
-            
-        150    ,
-            
-        138    ,
-            
-        120    ,
-            
-        111    ,
-            
-        123    ,
-            
-        131    ,
-            
-        138    ,
-            
-        143    ,
-            
-        151    ,
-            
-        137    ,
-            
-        119    ,
-            
-        121    ,
-            
-        132    ,
-            
-        139    ,
-            
-        145    ,
-            
-        150    ,
-            
-        135    ,
-            
-        122    ,
-            
-        120    ,
-            
-        128    ,
-            
-        135    ,
-            
-        141    ,
-            
-        149    ,
-            
-        141    ,
-            
-        124    ,
-            
-        111    ,
-            
-        122    ,
-            
-        133    ,
-            
-        138    ,
-            
-        146    ,
-            
-        149    ,
-            
-        140    ,
-            
-        120    ,
-            
-        116    ,
-            
-        126    ,
-            
-        134    ,
-            
-        141    ,
-            
-        147    ,
-            
-        146    ,
-            
-        128    ,
-            
-        115    ,
-            
-        126    ,
-            
-        134    ,
-            
-        140    ,
-            
-        147    ,
-            
-        148    ,
-            
-        134    ,
-            
-        115    ,
-            
-        111    ,
-            
-        124    ,
-            
-        132    ,
-            
-        139    ,
-            
-        145    ,
-            
-        149    ,
-            
-        136    ,
-            
-        120    ,
-            
-        124    ,
-            
-        132    ,
-            
-        138    ,
-            
-        145    ,
-            
-        151    ,
-            
-        138    ,
-            
-        120    ,
-            
-        112    ,
-            
-        120    ,
-            
-        130    ,
-            
-        135    ,
-            
-        142    ,
-            
-        147    ,
-            
-        147    ,
-            
-        130    ,
-            
-        120    ,
-            
-        124    ,
-            
-        131    ,
-            
-        139    ,
-            
-        147    ,
-            
-        147    ,
-            
-        136    ,
-            
-        122    ,
-            
-        109    ,
-            
-        124    ,
-            
-        131    ,
-            
-        138    ,
-            
-        142    ,
-            
-        148    ,
-            
-        145    ,
-            
-        123    ,
-            
-        117    ,
-            
-        127    ,
-            
-        132    ,
-            
-        139    ,
-            
-        143    ,
-            
-        148    ,
-            
-        147    ,
-            
-        128    ,
-            
-        116    ,
-            
-        123    ,
-            
-        131    ,
-            
-        136    ,
-            
-        142    ,
-            
-        147    ,
-            
-        149    ,
-            
-        136    ,
-            
-        123    ,
-            
-        112    ,
-            
-        118    ,
-            
-        126    ,
-            
-        133    ,
-            
-        138    ,
-            
-        143    ,
-            
-        147    ,
-            
-        146    ,
-            
-        131    ,
-            
-        108    ,
-            
-        117    ,
-            
-        123    ,
-            
-        132    ,
-            
-        135    ,
-            
-        141    ,
-            
-        144    ,
-            
-        150    ,
-            
-        139    ,
-            
-        121    ,
-            
-        95    ,
-            
-        109    ,
-            
-        109    ,
-            
-        124    ,
-            
-        130    ,
-            
-        135    ,
-            
-        141    ,
-            
-        146    ,
-            
-        150    ,
-            
-        141    ,
-            
-        121    ,
-            
-        102    ,
-            
-        111    ,
-            
-        116    ,
-            
-        127    ,
-            
-        132    ,
-            
-        137    ,
-            
-        141    ,
-            
-        146    ,
-            
-        149    ,
-            
-        135    ,
-            
-        120    ,
-            
-        109    ,
-            
-        111    ,
-            
-        124    ,
-            
-        127    ,
-            
-        134    ,
-            
-        137    ,
-            
-        144    ,
-            
-        148    ,
-            
-        148    ,
-            
-        132    ,
-            
-        111    ,
-            
-        110    ,
-            
-        121    ,
-            
-        127    ,
-            
-        132    ,
-            
-        135    ,
-            
-        138    ,
-            
-        141    ,
-            
-        143    ,
-            
-        145    ,
-            
-        144    ,
-            
-        146    ,
-            
-        147    ,
-            
-        148    ,
-            
-        146    ,
-            
-        148    ,
-            
-        136    ,
-            
-        117    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        122    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        128    ,
-            
-        129    ,
-            
-        130    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        130    ,
-            
-        132    ,
-            
-        128    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        137    ,
-            
-        136    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        140    ,
-            
-        142    ,
-            
-        145    ,
-            
-        144    ,
-            
-        138    ,
-            
-        147    ,
-            
-        146    ,
-            
-        148    ,
-            
-        145    ,
-            
-        141    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        150    ,
-            
-        127    ,
-            
-        97    ,
-            
-        98    ,
-            
-        100    ,
-            
-        101    ,
-            
-        103    ,
-            
-        103    ,
-            
-        105    ,
-            
-        105    ,
-            
-        107    ,
-            
-        108    ,
-            
-        107    ,
-            
-        108    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        111    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        118    ,
-            
-        119    ,
-            
-        120    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        141    ,
-            
-        140    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        140    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        142    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        145    ,
-            
-        149    ,
-            
-        134    ,
-            
-        109    ,
-            
-        99    ,
-            
-        99    ,
-            
-        99    ,
-            
-        100    ,
-            
-        100    ,
-            
-        101    ,
-            
-        102    ,
-            
-        103    ,
-            
-        103    ,
-            
-        105    ,
-            
-        105    ,
-            
-        104    ,
-            
-        106    ,
-            
-        105    ,
-            
-        105    ,
-            
-        107    ,
-            
-        88    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        120    ,
-            
-        120    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        122    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        135    ,
-            
-        135    ,
-            
-        137    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        150    ,
-            
-        130    ,
-            
-        99    ,
-            
-        99    ,
-            
-        101    ,
-            
-        103    ,
-            
-        104    ,
-            
-        107    ,
-            
-        108    ,
-            
-        109    ,
-            
-        111    ,
-            
-        111    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        121    ,
-            
-        123    ,
-            
-        124    ,
-            
-        125    ,
-            
-        126    ,
-            
-        127    ,
-            
-        128    ,
-            
-        129    ,
-            
-        130    ,
-            
-        132    ,
-            
-        133    ,
-            
-        135    ,
-            
-        136    ,
-            
-        138    ,
-            
-        139    ,
-            
-        141    ,
-            
-        141    ,
-            
-        143    ,
-            
-        145    ,
-            
-        145    ,
-            
-        149    ,
-            
-        149    ,
-            
-        144    ,
-            
-        119    ,
-            
-        117    ,
-            
-        117    ,
-            
-        120    ,
-            
-        123    ,
-            
-        125    ,
-            
-        126    ,
-            
-        127    ,
-            
-        129    ,
-            
-        130    ,
-            
-        131    ,
-            
-        132    ,
-            
-        134    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        139    ,
-            
-        139    ,
-            
-        141    ,
-            
-        142    ,
-            
-        143    ,
-            
-        144    ,
-            
-        145    ,
-            
-        146    ,
-            
-        147    ,
-            
-        148    ,
-            
-        149    ,
-            
-        148    ,
-            
-        122    ,
-            
-        112    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        121    ,
-            
-        122    ,
-            
-        124    ,
-            
-        126    ,
-            
-        127    ,
-            
-        128    ,
-            
-        130    ,
-            
-        131    ,
-            
-        132    ,
-            
-        133    ,
-            
-        134    ,
-            
-        135    ,
-            
-        136    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        140    ,
-            
-        141    ,
-            
-        142    ,
-            
-        143    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        141    ,
-            
-        115    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        116    ,
-            
-        118    ,
-            
-        118    ,
-            
-        118    ,
-            
-        121    ,
-            
-        122    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        136    ,
-            
-        134    ,
-            
-        136    ,
-            
-        135    ,
-            
-        137    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        139    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        150    ,
-            
-        136    ,
-            
-        111    ,
-            
-        97    ,
-            
-        98    ,
-            
-        99    ,
-            
-        100    ,
-            
-        101    ,
-            
-        101    ,
-            
-        102    ,
-            
-        104    ,
-            
-        105    ,
-            
-        105    ,
-            
-        107    ,
-            
-        106    ,
-            
-        109    ,
-            
-        110    ,
-            
-        111    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        120    ,
-            
-        121    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        150    ,
-            
-        142    ,
-            
-        111    ,
-            
-        110    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        115    ,
-            
-        115    ,
-            
-        116    ,
-            
-        118    ,
-            
-        118    ,
-            
-        119    ,
-            
-        120    ,
-            
-        120    ,
-            
-        121    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        143    ,
-            
-        141    ,
-            
-        142    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        150    ,
-            
-        128    ,
-            
-        101    ,
-            
-        101    ,
-            
-        103    ,
-            
-        105    ,
-            
-        105    ,
-            
-        106    ,
-            
-        107    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        80    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        150    ,
-            
-        150    ,
-            
-        150    ,
-            
-        149    ,
-            
-        150    ,
-            
-        149    ,
-            
-        150    ,
-            
-        150    ,
-            
-        149    ,
-            
-        127    ,
-            
-        101    ,
-            
-        100    ,
-            
-        100    ,
-            
-        101    ,
-            
-        100    ,
-            
-        99    ,
-            
-        99    ,
-            
-        102    ,
-            
-        101    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        103    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        103    ,
-            
-        102    ,
-            
-        102    ,
-            
-        103    ,
-            
-        103    ,
-            
-        102    ,
-            
-        103    ,
-            
-        104    ,
-            
-        104    ,
-            
-        103    ,
-            
-        103    ,
-            
-        104    ,
-            
-        104    ,
-            
-        104    ,
-            
-        103    ,
-            
-        103    ,
-            
-        105    ,
-            
-        105    ,
-            
-        104    ,
-            
-        104    ,
-            
-        105    ,
-            
-        106    ,
-            
-        105    ,
-            
-        105    ,
-            
-        105    ,
-            
-        107    ,
-            
-        107    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        121    ,
-            
-        121    ,
-            
-        123    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        145    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        145    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        141    ,
-            
-        123    ,
-            
-        105    ,
-            
-        106    ,
-            
-        107    ,
-            
-        107    ,
-            
-        86    ,
-            
-        106    ,
-            
-        106    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        94    ,
-            
-        93    ,
-            
-        93    ,
-            
-        93    ,
-            
-        93    ,
-            
-        93    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        109    ,
-            
-        110    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        120    ,
-            
-        120    ,
-            
-        119    ,
-            
-        119    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        122    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        130    ,
-            
-        131    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        134    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        135    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        134    ,
-            
-        135    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        137    ,
-            
-        136    ,
-            
-        135    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        131    ,
-            
-        135    ,
-            
-        136    ,
-            
-        135    ,
-            
-        134    ,
-            
-        134    ,
-            
-        140    ,
-            
-        140    ,
-            
-        138    ,
-            
-        137    ,
-            
-        136    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        140    ,
-            
-        143    ,
-            
-        146    ,
-            
-        143    ,
-            
-        143    ,
-            
-        147    ,
-            
-        148    ,
-            
-        150    ,
-            
-        135    ,
-            
-        119    ,
-            
-        118    ,
-            
-        120    ,
-            
-        123    ,
-            
-        124    ,
-            
-        125    ,
-            
-        127    ,
-            
-        128    ,
-            
-        129    ,
-            
-        131    ,
-            
-        132    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        134    ,
-            
-        136    ,
-            
-        136    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        140    ,
-            
-        140    ,
-            
-        139    ,
-            
-        139    ,
-            
-        138    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        142    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        147    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        142    ,
-            
-        120    ,
-            
-        111    ,
-            
-        110    ,
-            
-        111    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        114    ,
-            
-        113    ,
-            
-        114    ,
-            
-        113    ,
-            
-        113    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        150    ,
-            
-        149    ,
-            
-        150    ,
-            
-        150    ,
-            
-        149    ,
-            
-        149    ,
-            
-        139    ,
-            
-        121    ,
-            
-        93    ,
-            
-        93    ,
-            
-        93    ,
-            
-        93    ,
-            
-        93    ,
-            
-        94    ,
-            
-        94    ,
-            
-        94    ,
-            
-        94    ,
-            
-        95    ,
-            
-        94    ,
-            
-        95    ,
-            
-        96    ,
-            
-        95    ,
-            
-        94    ,
-            
-        95    ,
-            
-        95    ,
-            
-        95    ,
-            
-        96    ,
-            
-        96    ,
-            
-        97    ,
-            
-        96    ,
-            
-        95    ,
-            
-        95    ,
-            
-        95    ,
-            
-        95    ,
-            
-        96    ,
-            
-        97    ,
-            
-        97    ,
-            
-        97    ,
-            
-        97    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        99    ,
-            
-        99    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        99    ,
-            
-        98    ,
-            
-        98    ,
-            
-        99    ,
-            
-        99    ,
-            
-        99    ,
-            
-        99    ,
-            
-        99    ,
-            
-        99    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        101    ,
-            
-        101    ,
-            
-        101    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        104    ,
-            
-        105    ,
-            
-        104    ,
-            
-        104    ,
-            
-        104    ,
-            
-        105    ,
-            
-        105    ,
-            
-        105    ,
-            
-        105    ,
-            
-        105    ,
-            
-        105    ,
-            
-        106    ,
-            
-        106    ,
-            
-        105    ,
-            
-        105    ,
-            
-        105    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        105    ,
-            
-        105    ,
-            
-        106    ,
-            
-        106    ,
-            
-        107    ,
-            
-        107    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        124    ,
-            
-        124    ,
-            
-        126    ,
-            
-        124    ,
-            
-        124    ,
-            
-        126    ,
-            
-        125    ,
-            
-        127    ,
-            
-        124    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        133    ,
-            
-        134    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        138    ,
-            
-        139    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        144    ,
-            
-        147    ,
-            
-        150    ,
-            
-        141    ,
-            
-        126    ,
-            
-        118    ,
-            
-        125    ,
-            
-        130    ,
-            
-        137    ,
-            
-        144    ,
-            
-        151    ,
-            
-        139    ,
-            
-        125    ,
-            
-        110    ,
-            
-        120    ,
-            
-        131    ,
-            
-        140    ,
-            
-        145    ,
-            
-        149    ,
-            
-        135    ,
-            
-        118    ,
-            
-        127    ,
-            
-        138    ,
-            
-        149    ,
-            
-        148    ,
-            
-        135    ,
-            
-        125    ,
-            
-        123    ,
-            
-        136    ,
-            
-        149    ,
-            
-        145    ,
-            
-        139    ,
-            
-        128    ,
-            
-        119    ,
-            
-        138    ,
-            
-        150    ,
-            
-        147    ,
-            
-        139    ,
-            
-        134    ,
-            
-        126    ,
-            
-        119    ,
-            
-        138    ,
-            
-        153    ,
-            
-        148    ,
-            
-        141    ,
-            
-        135    ,
-            
-        126    ,
-            
-        121    ,
-            
-        139    ,
-            
-        154    ,
-            
-        148    ,
-            
-        140    ,
-            
-        133    ,
-            
-        125    ,
-            
-        124    ,
-            
-        139    ,
-            
-        154    ,
-            
-        148    ,
-            
-        143    ,
-            
-        140    ,
-            
-        138    ,
-            
-        143    ,
-            
-        143    ,
-            
-        141    ,
-            
-        142    ,
-            
-        147    ,
-            
-        153    ,
-            
-        157    ,
-            
-        161    ,
-            
-        168    ,
-            
-        175    ,
-            
-        179    ,
-            
-        182    ,
-            
-        186    ,
-            
-        189    ,
-            
-        191    ,
-            
-        193    ,
-            
-        194    ,
-            
-        197    ,
-            
-        198    ,
-            
-        201    ,
-            
-        204    ,
-            
-        206    ,
-            
-        207    ,
-            
-        211    ,
-            
-        213    ,
-            
-        216    ,
-            
-        217    ,
-            
-        220    ,
-            
-        222    ,
-            
-        223    ,
-            
-        225    ,
-            
-        227    ,
-            
-        226    ,
-            
-        228    ,
-            
-        229    ,
-            
-        230    ,
-            
-        230    ,
-            
-        231    ,
-            
-        232    ,
-            
-        234    ,
-            
-        233    ,
-            
-        234    ,
-            
-        235    ,
-            
-        235    ,
-            
-        236    ,
-            
-        238    ,
-            
-        239    ,
-            
-        240    ,
-            
-        241    ,
-            
-        241    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        241    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        242    ,
-            
-        241    ,
-            
-        241    ,
-            
-        241    ,
-            
-        241    ,
-            
-        240    ,
-            
-        240    ,
-            
-        240    ,
-            
-        240    ,
-            
-        239    ,
-            
-        239    ,
-            
-        239    ,
-            
-        238    ,
-            
-        236    ,
-            
-        237    ,
-            
-        236    ,
-            
-        235    ,
-            
-        235    ,
-            
-        234    ,
-            
-        234    ,
-            
-        233    ,
-            
-        233    ,
-            
-        233    ,
-            
-        231    ,
-            
-        230    ,
-            
-        231    ,
-            
-        229    ,
-            
-        229    ,
-            
-        228    ,
-            
-        227    ,
-            
-        227    ,
-            
-        226    ,
-            
-        226    ,
-            
-        225    ,
-            
-        225    ,
-            
-        224    ,
-            
-        223    ,
-            
-        223    ,
-            
-        222    ,
-            
-        221    ,
-            
-        221    ,
-            
-        219    ,
-            
-        219    ,
-            
-        219    ,
-            
-        218    ,
-            
-        217    ,
-            
-        216    ,
-            
-        216    ,
-            
-        214    ,
-            
-        214    ,
-            
-        213    ,
-            
-        212    ,
-            
-        211    ,
-            
-        210    ,
-            
-        210    ,
-            
-        208    ,
-            
-        207    ,
-            
-        207    ,
-            
-        206    ,
-            
-        204    ,
-            
-        203    ,
-            
-        202    ,
-            
-        200    ,
-            
-        199    ,
-            
-        199    ,
-            
-        197    ,
-            
-        194    ,
-            
-        193    ,
-            
-        191    ,
-            
-        190    ,
-            
-        188    ,
-            
-        184    ,
-            
-        180    ,
-            
-        176    ,
-            
-        173    ,
-            
-        158    ,
-            
-        137    ,
-            
-        120    ,
-            
-        113    ,
-            
-        113    ,
-            
-        124    ,
-            
-        129    ,
-            
-        133    ,
-            
-        136    ,
-            
-        139    ,
-            
-        142    ,
-            
-        145    ,
-            
-        148    ,
-            
-        150    ,
-            
-        137    ,
-            
-        122    ,
-            
-        108    ,
-            
-        111    ,
-            
-        113    ,
-            
-        113    ,
-            
-        123    ,
-            
-        127    ,
-            
-        131    ,
-            
-        134    ,
-            
-        136    ,
-            
-        139    ,
-            
-        141    ,
-            
-        144    ,
-            
-        143    ,
-            
-        148    ,
-            
-        144    ,
-            
-        121    ,
-            
-        118    ,
-            
-        118    ,
-            
-        120    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        126    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        126    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        136    ,
-            
-        136    ,
-            
-        138    ,
-            
-        137    ,
-            
-        138    ,
-            
-        136    ,
-            
-        138    ,
-            
-        137    ,
-            
-        138    ,
-            
-        139    ,
-            
-        138    ,
-            
-        138    ,
-            
-        137    ,
-            
-        139    ,
-            
-        139    ,
-            
-        138    ,
-            
-        139    ,
-            
-        140    ,
-            
-        139    ,
-            
-        138    ,
-            
-        140    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        137    ,
-            
-        140    ,
-            
-        142    ,
-            
-        142    ,
-            
-        140    ,
-            
-        142    ,
-            
-        140    ,
-            
-        142    ,
-            
-        141    ,
-            
-        139    ,
-            
-        140    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        142    ,
-            
-        139    ,
-            
-        142    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        141    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        140    ,
-            
-        142    ,
-            
-        140    ,
-            
-        141    ,
-            
-        143    ,
-            
-        141    ,
-            
-        144    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        141    ,
-            
-        143    ,
-            
-        144    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        143    ,
-            
-        147    ,
-            
-        144    ,
-            
-        148    ,
-            
-        146    ,
-            
-        144    ,
-            
-        145    ,
-            
-        148    ,
-            
-        148    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        147    ,
-            
-        145    ,
-            
-        148    ,
-            
-        146    ,
-            
-        148    ,
-            
-        140    ,
-            
-        116    ,
-            
-        106    ,
-            
-        106    ,
-            
-        108    ,
-            
-        106    ,
-            
-        108    ,
-            
-        107    ,
-            
-        107    ,
-            
-        109    ,
-            
-        108    ,
-            
-        109    ,
-            
-        109    ,
-            
-        108    ,
-            
-        110    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        118    ,
-            
-        125    ,
-            
-        130    ,
-            
-        135    ,
-            
-        140    ,
-            
-        147    ,
-            
-        148    ,
-            
-        133    ,
-            
-        120    ,
-            
-        112    ,
-            
-        124    ,
-            
-        133    ,
-            
-        140    ,
-            
-        147    ,
-            
-        149    ,
-            
-        138    ,
-            
-        121    ,
-            
-        95    ,
-            
-        115    ,
-            
-        129    ,
-            
-        143    ,
-            
-        152    ,
-            
-        146    ,
-            
-        138    ,
-            
-        133    ,
-            
-        131    ,
-            
-        131    ,
-            
-        130    ,
-            
-        134    ,
-            
-        136    ,
-            
-        141    ,
-            
-        143    ,
-            
-        145    ,
-            
-        151    ,
-            
-        158    ,
-            
-        162    ,
-            
-        168    ,
-            
-        174    ,
-            
-        176    ,
-            
-        177    ,
-            
-        178    ,
-            
-        180    ,
-            
-        182    ,
-            
-        182    ,
-            
-        182    ,
-            
-        181    ,
-            
-        183    ,
-            
-        184    ,
-            
-        185    ,
-            
-        185    ,
-            
-        186    ,
-            
-        187    ,
-            
-        188    ,
-            
-        190    ,
-            
-        191    ,
-            
-        193    ,
-            
-        194    ,
-            
-        197    ,
-            
-        198    ,
-            
-        200    ,
-            
-        201    ,
-            
-        201    ,
-            
-        204    ,
-            
-        206    ,
-            
-        207    ,
-            
-        208    ,
-            
-        211    ,
-            
-        212    ,
-            
-        213    ,
-            
-        215    ,
-            
-        216    ,
-            
-        217    ,
-            
-        219    ,
-            
-        220    ,
-            
-        220    ,
-            
-        221    ,
-            
-        223    ,
-            
-        224    ,
-            
-        225    ,
-            
-        225    ,
-            
-        226    ,
-            
-        227    ,
-            
-        226    ,
-            
-        228    ,
-            
-        228    ,
-            
-        229    ,
-            
-        231    ,
-            
-        231    ,
-            
-        230    ,
-            
-        231    ,
-            
-        230    ,
-            
-        229    ,
-            
-        231    ,
-            
-        230    ,
-            
-        230    ,
-            
-        229    ,
-            
-        229    ,
-            
-        228    ,
-            
-        229    ,
-            
-        228    ,
-            
-        227    ,
-            
-        227    ,
-            
-        227    ,
-            
-        226    ,
-            
-        227    ,
-            
-        226    ,
-            
-        225    ,
-            
-        225    ,
-            
-        224    ,
-            
-        223    ,
-            
-        223    ,
-            
-        222    ,
-            
-        220    ,
-            
-        221    ,
-            
-        220    ,
-            
-        219    ,
-            
-        219    ,
-            
-        218    ,
-            
-        217    ,
-            
-        217    ,
-            
-        214    ,
-            
-        215    ,
-            
-        214    ,
-            
-        213    ,
-            
-        212    ,
-            
-        212    ,
-            
-        211    ,
-            
-        210    ,
-            
-        209    ,
-            
-        207    ,
-            
-        206    ,
-            
-        206    ,
-            
-        205    ,
-            
-        203    ,
-            
-        201    ,
-            
-        200    ,
-            
-        199    ,
-            
-        197    ,
-            
-        196    ,
-            
-        194    ,
-            
-        194    ,
-            
-        191    ,
-            
-        189    ,
-            
-        187    ,
-            
-        184    ,
-            
-        182    ,
-            
-        176    ,
-            
-        166    ,
-            
-        148    ,
-            
-        129    ,
-            
-        120    ,
-            
-        120    ,
-            
-        123    ,
-            
-        126    ,
-            
-        131    ,
-            
-        134    ,
-            
-        137    ,
-            
-        139    ,
-            
-        142    ,
-            
-        143    ,
-            
-        147    ,
-            
-        149    ,
-            
-        144    ,
-            
-        126    ,
-            
-        105    ,
-            
-        111    ,
-            
-        112    ,
-            
-        124    ,
-            
-        130    ,
-            
-        133    ,
-            
-        138    ,
-            
-        141    ,
-            
-        144    ,
-            
-        146    ,
-            
-        148    ,
-            
-        150    ,
-            
-        132    ,
-            
-        102    ,
-            
-        108    ,
-            
-        111    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        123    ,
-            
-        125    ,
-            
-        128    ,
-            
-        131    ,
-            
-        134    ,
-            
-        136    ,
-            
-        138    ,
-            
-        140    ,
-            
-        142    ,
-            
-        144    ,
-            
-        147    ,
-            
-        149    ,
-            
-        150    ,
-            
-        126    ,
-            
-        110    ,
-            
-        111    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        123    ,
-            
-        125    ,
-            
-        127    ,
-            
-        129    ,
-            
-        131    ,
-            
-        132    ,
-            
-        135    ,
-            
-        136    ,
-            
-        138    ,
-            
-        140    ,
-            
-        141    ,
-            
-        143    ,
-            
-        144    ,
-            
-        146    ,
-            
-        148    ,
-            
-        149    ,
-            
-        141    ,
-            
-        119    ,
-            
-        115    ,
-            
-        115    ,
-            
-        114    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        130    ,
-            
-        131    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        150    ,
-            
-        150    ,
-            
-        136    ,
-            
-        120    ,
-            
-        101    ,
-            
-        100    ,
-            
-        101    ,
-            
-        101    ,
-            
-        101    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        103    ,
-            
-        102    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        105    ,
-            
-        103    ,
-            
-        104    ,
-            
-        105    ,
-            
-        105    ,
-            
-        104    ,
-            
-        106    ,
-            
-        106    ,
-            
-        105    ,
-            
-        105    ,
-            
-        106    ,
-            
-        105    ,
-            
-        105    ,
-            
-        107    ,
-            
-        107    ,
-            
-        106    ,
-            
-        107    ,
-            
-        108    ,
-            
-        107    ,
-            
-        106    ,
-            
-        108    ,
-            
-        108    ,
-            
-        107    ,
-            
-        107    ,
-            
-        109    ,
-            
-        108    ,
-            
-        108    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        65    ,
-            
-        65    ,
-            
-        65    ,
-            
-        65    ,
-            
-        65    ,
-            
-        65    ,
-            
-        70    ,
-            
-        70    ,
-            
-        74    ,
-            
-        118    ,
-            
-        118    ,
-            
-        118    ,
-            
-        118    ,
-            
-        118    ,
-            
-        118    ,
-            
-        118    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        122    ,
-            
-        122    ,
-            
-        126    ,
-            
-        129    ,
-            
-        131    ,
-            
-        135    ,
-            
-        137    ,
-            
-        139    ,
-            
-        140    ,
-            
-        142    ,
-            
-        145    ,
-            
-        147    ,
-            
-        148    ,
-            
-        146    ,
-            
-        128    ,
-            
-        114    ,
-            
-        117    ,
-            
-        120    ,
-            
-        123    ,
-            
-        126    ,
-            
-        128    ,
-            
-        130    ,
-            
-        131    ,
-            
-        134    ,
-            
-        136    ,
-            
-        139    ,
-            
-        137    ,
-            
-        140    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        145    ,
-            
-        147    ,
-            
-        149    ,
-            
-        148    ,
-            
-        128    ,
-            
-        114    ,
-            
-        115    ,
-            
-        115    ,
-            
-        115    ,
-            
-        115    ,
-            
-        115    ,
-            
-        121    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        125    ,
-            
-        125    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        127    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        133    ,
-            
-        134    ,
-            
-        133    ,
-            
-        135    ,
-            
-        137    ,
-            
-        138    ,
-            
-        140    ,
-            
-        142    ,
-            
-        142    ,
-            
-        144    ,
-            
-        147    ,
-            
-        146    ,
-            
-        148    ,
-            
-        138    ,
-            
-        120    ,
-            
-        109    ,
-            
-        112    ,
-            
-        119    ,
-            
-        123    ,
-            
-        127    ,
-            
-        133    ,
-            
-        138    ,
-            
-        143    ,
-            
-        147    ,
-            
-        148    ,
-            
-        139    ,
-            
-        122    ,
-            
-        109    ,
-            
-        114    ,
-            
-        122    ,
-            
-        126    ,
-            
-        131    ,
-            
-        134    ,
-            
-        138    ,
-            
-        141    ,
-            
-        142    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        125    ,
-            
-        109    ,
-            
-        111    ,
-            
-        112    ,
-            
-        113    ,
-            
-        121    ,
-            
-        123    ,
-            
-        126    ,
-            
-        129    ,
-            
-        129    ,
-            
-        133    ,
-            
-        134    ,
-            
-        136    ,
-            
-        138    ,
-            
-        139    ,
-            
-        141    ,
-            
-        142    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        148    ,
-            
-        139    ,
-            
-        116    ,
-            
-        105    ,
-            
-        107    ,
-            
-        108    ,
-            
-        109    ,
-            
-        111    ,
-            
-        112    ,
-            
-        113    ,
-            
-        126    ,
-            
-        132    ,
-            
-        139    ,
-            
-        144    ,
-            
-        148    ,
-            
-        143    ,
-            
-        124    ,
-            
-        98    ,
-            
-        110    ,
-            
-        110    ,
-            
-        122    ,
-            
-        128    ,
-            
-        132    ,
-            
-        136    ,
-            
-        142    ,
-            
-        143    ,
-            
-        147    ,
-            
-        148    ,
-            
-        136    ,
-            
-        115    ,
-            
-        118    ,
-            
-        122    ,
-            
-        126    ,
-            
-        128    ,
-            
-        131    ,
-            
-        133    ,
-            
-        134    ,
-            
-        137    ,
-            
-        139    ,
-            
-        140    ,
-            
-        142    ,
-            
-        143    ,
-            
-        145    ,
-            
-        149    ,
-            
-        147    ,
-            
-        143    ,
-            
-        120    ,
-            
-        119    ,
-            
-        121    ,
-            
-        122    ,
-            
-        124    ,
-            
-        125    ,
-            
-        127    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        135    ,
-            
-        136    ,
-            
-        137    ,
-            
-        139    ,
-            
-        141    ,
-            
-        142    ,
-            
-        144    ,
-            
-        143    ,
-            
-        146    ,
-            
-        147    ,
-            
-        148    ,
-            
-        149    ,
-            
-        144    ,
-            
-        123    ,
-            
-        114    ,
-            
-        114    ,
-            
-        114    ,
-            
-        120    ,
-            
-        123    ,
-            
-        125    ,
-            
-        126    ,
-            
-        128    ,
-            
-        128    ,
-            
-        130    ,
-            
-        132    ,
-            
-        132    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        136    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        140    ,
-            
-        110    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        67    ,
-            
-        67    ,
-            
-        67    ,
-            
-        67    ,
-            
-        67    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        122    ,
-            
-        123    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        122    ,
-            
-        123    ,
-            
-        124    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        131    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        133    ,
-            
-        136    ,
-            
-        135    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        137    ,
-            
-        136    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        137    ,
-            
-        138    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        136    ,
-            
-        136    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        142    ,
-            
-        141    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        142    ,
-            
-        144    ,
-            
-        142    ,
-            
-        141    ,
-            
-        144    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        146    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        147    ,
-            
-        149    ,
-            
-        148    ,
-            
-        148    ,
-            
-        145    ,
-            
-        124    ,
-            
-        110    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        126    ,
-            
-        127    ,
-            
-        128    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        145    ,
-            
-        148    ,
-            
-        149    ,
-            
-        130    ,
-            
-        118    ,
-            
-        124    ,
-            
-        134    ,
-            
-        139    ,
-            
-        145    ,
-            
-        148    ,
-            
-        137    ,
-            
-        120    ,
-            
-        122    ,
-            
-        128    ,
-            
-        135    ,
-            
-        139    ,
-            
-        145    ,
-            
-        148    ,
-            
-        148    ,
-            
-        135    ,
-            
-        110    ,
-            
-        108    ,
-            
-        112    ,
-            
-        112    ,
-            
-        122    ,
-            
-        127    ,
-            
-        130    ,
-            
-        132    ,
-            
-        135    ,
-            
-        137    ,
-            
-        140    ,
-            
-        141    ,
-            
-        142    ,
-            
-        144    ,
-            
-        145    ,
-            
-        147    ,
-            
-        148    ,
-            
-        149    ,
-            
-        150    ,
-            
-        143    ,
-            
-        120    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        65    ,
-            
-        95    ,
-            
-        78    ,
-            
-        120    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        133    ,
-            
-        134    ,
-            
-        133    ,
-            
-        134    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        142    ,
-            
-        142    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        145    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        145    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        147    ,
-            
-        147    ,
-            
-        144    ,
-            
-        147    ,
-            
-        145    ,
-            
-        144    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        150    ,
-            
-        150    ,
-            
-        147    ,
-            
-        123    ,
-            
-        106    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        108    ,
-            
-        107    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        106    ,
-            
-        106    ,
-            
-        109    ,
-            
-        109    ,
-            
-        108    ,
-            
-        108    ,
-            
-        107    ,
-            
-        107    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        108    ,
-            
-        108    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        121    ,
-            
-        120    ,
-            
-        120    ,
-            
-        121    ,
-            
-        120    ,
-            
-        107    ,
-            
-        120    ,
-            
-        120    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        128    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        129    ,
-            
-        131    ,
-            
-        131    ,
-            
-        129    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        130    ,
-            
-        128    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        131    ,
-            
-        132    ,
-            
-        134    ,
-            
-        132    ,
-            
-        133    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        129    ,
-            
-        131    ,
-            
-        128    ,
-            
-        129    ,
-            
-        130    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        129    ,
-            
-        133    ,
-            
-        130    ,
-            
-        131    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        130    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        131    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        134    ,
-            
-        135    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        138    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        140    ,
-            
-        141    ,
-            
-        140    ,
-            
-        141    ,
-            
-        142    ,
-            
-        139    ,
-            
-        141    ,
-            
-        139    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        140    ,
-            
-        141    ,
-            
-        143    ,
-            
-        142    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        140    ,
-            
-        144    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        141    ,
-            
-        143    ,
-            
-        143    ,
-            
-        142    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        145    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        147    ,
-            
-        128    ,
-            
-        98    ,
-            
-        98    ,
-            
-        98    ,
-            
-        99    ,
-            
-        99    ,
-            
-        99    ,
-            
-        99    ,
-            
-        99    ,
-            
-        99    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        100    ,
-            
-        101    ,
-            
-        101    ,
-            
-        101    ,
-            
-        100    ,
-            
-        101    ,
-            
-        101    ,
-            
-        101    ,
-            
-        101    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        102    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        102    ,
-            
-        103    ,
-            
-        104    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        104    ,
-            
-        105    ,
-            
-        105    ,
-            
-        104    ,
-            
-        104    ,
-            
-        104    ,
-            
-        104    ,
-            
-        106    ,
-            
-        106    ,
-            
-        105    ,
-            
-        105    ,
-            
-        105    ,
-            
-        105    ,
-            
-        107    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        106    ,
-            
-        108    ,
-            
-        107    ,
-            
-        107    ,
-            
-        106    ,
-            
-        106    ,
-            
-        107    ,
-            
-        107    ,
-            
-        108    ,
-            
-        108    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        107    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        121    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        126    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        125    ,
-            
-        126    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        126    ,
-            
-        126    ,
-            
-        128    ,
-            
-        127    ,
-            
-        126    ,
-            
-        127    ,
-            
-        126    ,
-            
-        126    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        127    ,
-            
-        126    ,
-            
-        125    ,
-            
-        126    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        128    ,
-            
-        127    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        125    ,
-            
-        126    ,
-            
-        128    ,
-            
-        124    ,
-            
-        126    ,
-            
-        125    ,
-            
-        126    ,
-            
-        125    ,
-            
-        127    ,
-            
-        127    ,
-            
-        125    ,
-            
-        126    ,
-            
-        128    ,
-            
-        129    ,
-            
-        125    ,
-            
-        126    ,
-            
-        128    ,
-            
-        127    ,
-            
-        125    ,
-            
-        128    ,
-            
-        126    ,
-            
-        126    ,
-            
-        128    ,
-            
-        126    ,
-            
-        127    ,
-            
-        128    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        127    ,
-            
-        130    ,
-            
-        128    ,
-            
-        129    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        127    ,
-            
-        130    ,
-            
-        129    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        128    ,
-            
-        131    ,
-            
-        129    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        130    ,
-            
-        130    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        141    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        141    ,
-            
-        142    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        145    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        139    ,
-            
-        122    ,
-            
-        103    ,
-            
-        104    ,
-            
-        103    ,
-            
-        103    ,
-            
-        103    ,
-            
-        104    ,
-            
-        105    ,
-            
-        104    ,
-            
-        105    ,
-            
-        105    ,
-            
-        105    ,
-            
-        106    ,
-            
-        106    ,
-            
-        105    ,
-            
-        107    ,
-            
-        107    ,
-            
-        106    ,
-            
-        106    ,
-            
-        108    ,
-            
-        107    ,
-            
-        106    ,
-            
-        108    ,
-            
-        108    ,
-            
-        107    ,
-            
-        107    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        108    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        108    ,
-            
-        108    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        117    ,
-            
-        117    ,
-            
-        117    ,
-            
-        117    ,
-            
-        117    ,
-            
-        117    ,
-            
-        117    ,
-            
-        115    ,
-            
-        67    ,
-            
-        67    ,
-            
-        66    ,
-            
-        66    ,
-            
-        66    ,
-            
-        66    ,
-            
-        66    ,
-            
-        66    ,
-            
-        66    ,
-            
-        66    ,
-            
-        66    ,
-            
-        66    ,
-            
-        66    ,
-            
-        67    ,
-            
-        67    ,
-            
-        67    ,
-            
-        67    ,
-            
-        67    ,
-            
-        67    ,
-            
-        67    ,
-            
-        84    ,
-            
-        68    ,
-            
-        68    ,
-            
-        68    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        119    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-        120    ,
-            
-        120    ,
-            
-        104    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        120    ,
-            
-        121    ,
-            
-        120    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        121    ,
-            
-        122    ,
-            
-        121    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        122    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        123    ,
-            
-        123    ,
-            
-        123    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        124    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        124    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        125    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        126    ,
-            
-        126    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        127    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        128    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        129    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        130    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        132    ,
-            
-        131    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        132    ,
-            
-        132    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        132    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        133    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        134    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        135    ,
-            
-        135    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        136    ,
-            
-        137    ,
-            
-        136    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        138    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        137    ,
-            
-        136    ,
-            
-        137    ,
-            
-        138    ,
-            
-        137    ,
-            
-        138    ,
-            
-        138    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        139    ,
-            
-        140    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        141    ,
-            
-        141    ,
-            
-        142    ,
-            
-        141    ,
-            
-        142    ,
-            
-        142    ,
-            
-        141    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        142    ,
-            
-        143    ,
-            
-        143    ,
-            
-        143    ,
-            
-        142    ,
-            
-        143    ,
-            
-        141    ,
-            
-        142    ,
-            
-        141    ,
-            
-        142    ,
-            
-        144    ,
-            
-        143    ,
-            
-        144    ,
-            
-        143    ,
-            
-        143    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        144    ,
-            
-        146    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        146    ,
-            
-        145    ,
-            
-        144    ,
-            
-        145    ,
-            
-        147    ,
-            
-        145    ,
-            
-        145    ,
-            
-        145    ,
-            
-        147    ,
-            
-        144    ,
-            
-        147    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        147    ,
-            
-        147    ,
-            
-        146    ,
-            
-        146    ,
-            
-        146    ,
-            
-        147    ,
-            
-        148    ,
-            
-        147    ,
-            
-        147    ,
-            
-        148    ,
-            
-        146    ,
-            
-        148    ,
-            
-        148    ,
-            
-        147    ,
-            
-        148    ,
-            
-        147    ,
-            
-        148    ,
-            
-        146    ,
-            
-        147    ,
-            
-        146    ,
-            
-        147    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        148    ,
-            
-        149    ,
-            
-        149    ,
-            
-        149    ,
-            
-        150    ,
-            
-        140    ,
-            
-        120    ,
-            
-        105    ,
-            
-        107    ,
-            
-        107    ,
-            
-        106    ,
-            
-        108    ,
-            
-        107    ,
-            
-        107    ,
-            
-        108    ,
-            
-        108    ,
-            
-        107    ,
-            
-        108    ,
-            
-        108    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        109    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        110    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        111    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        112    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113    ,
-            
-        113
-    };
-    int i =0;
+
   static TypeId GetTypeId (void);
 
   /**
    * Set the sending interval
-   * \param interval the interval between two packet sendings
+   * \param interval the interval between two packet sendings. If zero, the
+   * interval is drawn when the application starts, from the distribution of
+   * TR 45.820: one day, two hours, one hour or 30 minutes with probability
+   * 0.4, 0.4, 0.15 and 0.05.
    */
   void SetInterval (Time interval);
 
@@ -21583,13 +67,45 @@ public:
    */
   void SetInitialDelay (Time delay);
 
+  /**
+   * \param random Whether to draw the initial delay uniformly within the
+   * first interval every time the application starts, instead of using the
+   * delay set with SetInitialDelay.
+   */
+  void SetRandomInitialDelay (bool random);
+
   /**
    * Set packet size
    */
   void SetPacketSize (uint8_t size);
 
   /**
-   * Set if using randomness in the packet size
+   * Set the measurement of the sensor trace this application starts from,
+   * so that devices do not all read the same values at the same time.
+   *
+   * \param phase The index of the first measurement.
+   */
+  void SetSensorTracePhase (uint32_t phase);
+
+  /**
+   * Set the weather seen by the Weather Driven Strategy.
+   *
+   * \param weather The weather process, typically shared with other devices.
+   */
+  void SetWeatherProcess (Ptr<WeatherProcess> weather);
+
+  /**
+   * Have a FleetTrafficGenerator schedule the messages of this application,
+   * instead of scheduling its own events. Must be set before the application
+   * starts.
+   *
+   * \param fleet The generator, typically shared with other applications.
+   */
+  void SetFleetTrafficGenerator (Ptr<FleetTrafficGenerator> fleet);
+
+  /**
+   * Set if using randomness in the packet size. The value drawn for each
+   * packet is added to the base size, up to the maximum Sigfox payload.
    */
   void SetPacketSizeRandomVariable (Ptr <RandomVariableStream> rv);
 
@@ -21608,6 +124,18 @@ public:
    * Stop the application
    */
   void StopApplication (void);
+
+  /**
+   * Stop sending until Resume is called, e.g., because the battery is
+   * depleted. The pending events of the application are cancelled, so a
+   * suspended application costs no events.
+   */
+  void Suspend (void);
+
+  /**
+   * Start sending again after Suspend, one interval from now.
+   */
+  void Resume (void);
     //int sendcnt=0;
     /**
      * Select Transmission Strategy
@@ -21617,6 +145,25 @@ public:
     
     void EnableSendingData(void);  // for Data Compression Strategy
     void EnableSendingWeather (void); // for Weather Driven Strategy
+
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by this application: the interval, the initial delay and, if one
+   * was set, the packet size random variable. Usually called through
+   * SigfoxHelper::AssignStreams, before or after the application is
+   * installed, as long as it has not started.
+   *
+   * The weather process is shared with other devices and gets its streams
+   * from WeatherProcess::AssignStreams.
+   *
+   * \param stream The first stream index to use.
+   * \return The number of stream indices assigned by this application.
+   */
+  int64_t AssignStreams (int64_t stream);
+
+protected:
+  virtual void DoDispose (void);
+
 private:
   /**
    * The interval between to consecutive send events
@@ -21628,11 +175,41 @@ private:
    */
   Time m_initialDelay;
 
+  /**
+   * Whether the initial delay is drawn when the application starts
+   */
+  bool m_randomInitialDelay;
+
+  /**
+   * The random variable that draws a zero interval
+   */
+  Ptr<UniformRandomVariable> m_intervalRV;
+
+  /**
+   * The random variable that draws the initial delay
+   */
+  Ptr<UniformRandomVariable> m_initialDelayRV;
+
   /**
    * The sending event scheduled as next
    */
   EventId m_sendEvent;
 
+  /**
+   * The next measurement of the Data Compression Strategy
+   */
+  EventId m_sensorEvent;
+
+  /**
+   * Whether the application is between StartApplication and StopApplication
+   */
+  bool m_running;
+
+  /**
+   * Whether the application is suspended
+   */
+  bool m_suspended;
+
   /**
    * The MAC layer of this node
    */
@@ -21653,7 +230,25 @@ private:
    */
   Ptr<RandomVariableStream> m_pktSizeRV;
 
+  /**
+   * The weather seen by the Weather Driven Strategy, usually shared by the
+   * devices of a region. Created on first use if none is set.
+   */
+  Ptr<WeatherProcess> m_weather;
+
+  /**
+   * The generator that schedules the messages of this application, if any.
+   */
+  Ptr<FleetTrafficGenerator> m_fleet;
+
+  /**
+   * The measurements read by the Data Compression Strategy, shared with the
+   * other applications. Opened on first use.
+   */
+  Ptr<const SensorTraceStore> m_sensorTrace;
 
+  std::string m_sensorTraceFile; //!< The file of the measurements
+  uint64_t m_sensorTraceCursor;  //!< The index of the next measurement
 };
 
 } //namespace ns3
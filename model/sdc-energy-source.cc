@@ -22,8 +22,11 @@
 #include "ns3/log.h"
 #include "ns3/assert.h"
 #include "ns3/double.h"
+#include "ns3/string.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/simulator.h"
+#include <algorithm>
+#include <cmath>
 
 namespace ns3 {
 
@@ -66,11 +69,42 @@ SdcEnergySource::GetTypeId (void)
                    MakeDoubleAccessor (&SdcEnergySource::m_sdcParameter),
                    MakeDoubleChecker<double> ())
     .AddAttribute ("SdcPeriodicEnergyUpdateInterval",
-                   "Time between two consecutive periodic energy updates.",
-                   TimeValue (Seconds (3600.0)),
+                   "Time between two consecutive periodic energy updates, "
+                   "or zero to only update when needed. Periodic updates "
+                   "stop while the source is depleted.",
+                   TimeValue (Seconds (0)),
                    MakeTimeAccessor (&SdcEnergySource::SetEnergyUpdateInterval,
                                      &SdcEnergySource::GetEnergyUpdateInterval),
                    MakeTimeChecker ())
+    .AddAttribute ("SdcIrradianceFile",
+                   "The hourly irradiance timeline to harvest from, or empty "
+                   "not to harvest.",
+                   StringValue (""),
+                   MakeStringAccessor (&SdcEnergySource::SetIrradianceFile,
+                                       &SdcEnergySource::GetIrradianceFile),
+                   MakeStringChecker ())
+    .AddAttribute ("SdcHarvesterAreaM2",
+                   "The area of the solar harvester, in square meters.",
+                   DoubleValue (0.001),
+                   MakeDoubleAccessor (&SdcEnergySource::m_harvesterAreaM2),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("SdcHarvesterEfficiency",
+                   "The fraction of the irradiance the harvester converts.",
+                   DoubleValue (0.15),
+                   MakeDoubleAccessor (&SdcEnergySource::m_harvesterEfficiency),
+                   MakeDoubleChecker<double> (0, 1))
+    .AddAttribute ("SdcIrradianceOffset",
+                   "The time of the irradiance timeline at the start of the "
+                   "simulation.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&SdcEnergySource::m_irradianceOffset),
+                   MakeTimeChecker (Seconds (0)))
+    .AddAttribute ("SdcPredictionHorizon",
+                   "How far ahead threshold crossings are searched when "
+                   "harvesting.",
+                   TimeValue (Days (1)),
+                   MakeTimeAccessor (&SdcEnergySource::m_predictionHorizon),
+                   MakeTimeChecker (Hours (1)))
     .AddTraceSource ("SdcRemainingEnergy",
                      "SdcRemaining energy at SdcEnergySource.",
                      MakeTraceSourceAccessor (&SdcEnergySource::m_remainingEnergyJ),
@@ -83,6 +117,7 @@ SdcEnergySource::SdcEnergySource ()
 {
   NS_LOG_FUNCTION (this);
   m_lastUpdateTime = Seconds (0.0);
+  m_drainedChargeC = 0;
   m_depleted = false;
 }
 
@@ -114,6 +149,21 @@ SdcEnergySource::SetEnergyUpdateInterval (Time interval)
   m_energyUpdateInterval = interval;
 }
 
+void
+SdcEnergySource::SetIrradianceFile (std::string path)
+{
+  NS_LOG_FUNCTION (this << path);
+  m_irradianceFile = path;
+  m_irradiance = path.empty () ? 0 : sigfox::IrradianceTimeline::Open (path);
+}
+
+std::string
+SdcEnergySource::GetIrradianceFile (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_irradianceFile;
+}
+
 Time
 SdcEnergySource::GetEnergyUpdateInterval (void) const
 {
@@ -179,12 +229,144 @@ SdcEnergySource::UpdateEnergySource (void)
       NotifyEnergyChanged ();
     }
 
-  if (m_energyUpdateEvent.IsExpired ())
+  if (m_depleted)
+    {
+      // A depleted source is only updated when queried, or when it is
+      // predicted to recharge
+      m_energyUpdateEvent.Cancel ();
+    }
+  else if (m_energyUpdateInterval.IsStrictlyPositive () && m_energyUpdateEvent.IsExpired ())
     {
       m_energyUpdateEvent = Simulator::Schedule (m_energyUpdateInterval,
                                                  &SdcEnergySource::UpdateEnergySource,
                                                  this);
     }
+
+  if (!m_predictionEvent.IsRunning ())
+    {
+      m_predictionEvent = Simulator::ScheduleNow (&SdcEnergySource::ScheduleThresholdEvent,
+                                                  this);
+    }
+}
+
+Time
+SdcEnergySource::GetTimeToDepletion (double totalCurrentA)
+{
+  NS_LOG_FUNCTION (this << totalCurrentA);
+
+  UpdateEnergySource ();
+  return GetTimeToEnergy (m_lowBatteryTh * m_initialEnergyJ, totalCurrentA);
+}
+
+double
+SdcEnergySource::GetTotalDrainedCharge (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  UpdateEnergySource ();
+  return m_drainedChargeC;
+}
+
+Time
+SdcEnergySource::GetTimeToEnergy (double energyJ, double totalCurrentA) const
+{
+  NS_LOG_FUNCTION (this << energyJ << totalCurrentA);
+
+  double powerW = totalCurrentA * m_supplyVoltageV;
+  double seconds = -1;
+  if (m_irradiance == 0)
+    {
+      if (m_remainingEnergyJ <= energyJ)
+        {
+          return Seconds (0);
+        }
+      seconds = SolveEnergy (m_remainingEnergyJ, powerW, energyJ);
+    }
+  else
+    {
+      // Go through the hours of the timeline, up to the horizon
+      double energy = m_remainingEnergyJ;
+      double elapsed = 0;
+      Time time = m_lastUpdateTime;
+      Time horizon = m_lastUpdateTime + m_predictionHorizon;
+      while (time < horizon)
+        {
+          uint64_t hour;
+          Time end = std::min (GetHourAt (time, hour), horizon);
+          double netPowerW = powerW - GetHarvestedPowerW (hour);
+          double length = (end - time).GetSeconds ();
+          double s = SolveEnergy (energy, netPowerW, energyJ);
+          if (s >= 0 && s <= length)
+            {
+              seconds = elapsed + s;
+              break;
+            }
+          energy = IntegrateEnergy (energy, netPowerW, length);
+          elapsed += length;
+          time = end;
+        }
+    }
+
+  // Never, or past the end of any simulation
+  if (seconds < 0 || seconds > Time::Max ().GetSeconds () / 2)
+    {
+      return Time::Max ();
+    }
+
+  // Round up, so that the threshold is crossed when we get there
+  return Seconds (seconds) + TimeStep (1);
+}
+
+void
+SdcEnergySource::ScheduleThresholdEvent (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_depleted && m_irradiance == 0)
+    {
+      // Devices only draw energy, so the high threshold cannot be crossed
+      if (m_thresholdEvent.IsRunning ())
+        {
+          Simulator::Remove (m_thresholdEvent);
+        }
+      return;
+    }
+
+  double threshold = m_depleted ? m_highBatteryTh : m_lowBatteryTh;
+  Time delay = GetTimeToEnergy (threshold * m_initialEnergyJ, CalculateTotalCurrent ());
+  if (delay == Time::Max ())
+    {
+      if (m_irradiance == 0)
+        {
+          // A pending event fires too early at worst, and predicts again
+          return;
+        }
+      // Not within the horizon: search again from there
+      delay = m_predictionHorizon;
+    }
+
+  // The energy is up to date as of m_lastUpdateTime
+  delay = m_lastUpdateTime + delay - Simulator::Now ();
+  if (delay.IsNegative ())
+    {
+      delay = Seconds (0);
+    }
+
+  // The prediction changes with every change of the current, possibly
+  // years ahead. Cancelled events stay in the scheduler until their time, so
+  // only move the event when it would otherwise be late: when it fires too
+  // early, the prediction is simply done again.
+  if (m_thresholdEvent.IsRunning ())
+    {
+      if (Simulator::GetDelayLeft (m_thresholdEvent) <= delay)
+        {
+          return;
+        }
+      Simulator::Remove (m_thresholdEvent);
+    }
+
+  NS_LOG_DEBUG ("SdcEnergySource:Next threshold check in " << delay.GetSeconds () << " s");
+  m_thresholdEvent = Simulator::Schedule (delay, &SdcEnergySource::UpdateEnergySource, this);
 }
 
 /*
@@ -202,6 +384,9 @@ void
 SdcEnergySource::DoDispose (void)
 {
   NS_LOG_FUNCTION (this);
+  m_energyUpdateEvent.Cancel ();
+  m_thresholdEvent.Cancel ();
+  m_predictionEvent.Cancel ();
   BreakDeviceEnergyModelRefCycle ();  // break reference cycle
 }
 
@@ -229,20 +414,97 @@ SdcEnergySource::SdcCalculateRemainingEnergy (void)
   Time duration = Simulator::Now () - m_lastUpdateTime;
   NS_ASSERT (duration.IsPositive ());
   // energy = current * voltage * time
-  double remainingEnergyJ = 0;
-  if (m_sdcParameter > 0) {
-	  double param = -log(m_sdcParameter) / 2592000;
-	  double tmp = totalCurrentA * m_supplyVoltageV / param;
-	  remainingEnergyJ = exp(-param*duration.GetSeconds()) * (m_remainingEnergyJ + tmp) - tmp;
-//	  fprintf(stderr, "I am actually %E %E %E.\n", param, tmp, Simulator::Now().GetSeconds());
-  } else {
-	  remainingEnergyJ -= (totalCurrentA * m_supplyVoltageV * duration).GetSeconds();
-  }
-//  fprintf(stderr, "I am finally in SdcCalculateRemainingEnergy.\n\tvoltage %lf current %f time elapsed %f energy from %f to %f\n", m_supplyVoltageV, totalCurrentA, duration.GetSeconds(), (double)m_remainingEnergyJ, remainingEnergyJ);
-
-  NS_ASSERT (remainingEnergyJ >= 0);
+  double powerW = totalCurrentA * m_supplyVoltageV;
+  m_drainedChargeC += totalCurrentA * duration.GetSeconds ();
+  double remainingEnergyJ = m_remainingEnergyJ;
+  if (m_irradiance == 0)
+    {
+      remainingEnergyJ = IntegrateEnergy (remainingEnergyJ, powerW, duration.GetSeconds ());
+    }
+  else
+    {
+      // The harvested power changes every hour
+      Time time = m_lastUpdateTime;
+      while (time < Simulator::Now ())
+        {
+          uint64_t hour;
+          Time end = std::min (GetHourAt (time, hour), Simulator::Now ());
+          remainingEnergyJ = IntegrateEnergy (remainingEnergyJ, powerW - GetHarvestedPowerW (hour),
+                                              (end - time).GetSeconds ());
+          time = end;
+        }
+    }
+
   m_remainingEnergyJ = remainingEnergyJ;
   NS_LOG_DEBUG ("SdcEnergySource:Remaining energy = " << m_remainingEnergyJ);
 }
 
+double
+SdcEnergySource::GetHarvestedPowerW (uint64_t hour) const
+{
+  return m_irradiance->GetIrradiance (hour) * m_harvesterAreaM2 * m_harvesterEfficiency;
+}
+
+Time
+SdcEnergySource::GetHourAt (Time time, uint64_t &hour) const
+{
+  int64_t step = sigfox::IrradianceTimeline::GetStep ().GetTimeStep ();
+  hour = (time + m_irradianceOffset).GetTimeStep () / step;
+  return TimeStep ((hour + 1) * step) - m_irradianceOffset;
+}
+
+double
+SdcEnergySource::IntegrateEnergy (double energyJ, double netPowerW, double seconds) const
+{
+  double remainingEnergyJ;
+  if (m_sdcParameter > 0 && m_sdcParameter < 1)
+    {
+      double param = -std::log (m_sdcParameter) / 2592000;
+      double tmp = netPowerW / param;
+      remainingEnergyJ = std::exp (-param * seconds) * (energyJ + tmp) - tmp;
+    }
+  else
+    {
+      // No self-discharge
+      remainingEnergyJ = energyJ - netPowerW * seconds;
+    }
+
+  // The battery cannot be charged beyond its initial energy
+  return std::min (std::max (remainingEnergyJ, 0.0), m_initialEnergyJ);
+}
+
+double
+SdcEnergySource::SolveEnergy (double energyJ, double netPowerW, double targetJ) const
+{
+  if (energyJ == targetJ)
+    {
+      return 0;
+    }
+  if (targetJ > m_initialEnergyJ || targetJ < 0)
+    {
+      return -1;
+    }
+
+  if (m_sdcParameter > 0 && m_sdcParameter < 1)
+    {
+      // The energy moves monotonically towards the equilibrium between
+      // self-discharge and net power, so the target must be in between
+      double param = -std::log (m_sdcParameter) / 2592000;
+      double equilibrium = -netPowerW / param;
+      if ((targetJ - energyJ) * (equilibrium - energyJ) <= 0 ||
+          std::abs (targetJ - energyJ) >= std::abs (equilibrium - energyJ))
+        {
+          return -1;
+        }
+      return -std::log ((targetJ - equilibrium) / (energyJ - equilibrium)) / param;
+    }
+
+  if (netPowerW == 0)
+    {
+      return -1;
+    }
+  double seconds = (energyJ - targetJ) / netPowerW;
+  return seconds >= 0 ? seconds : -1;
+}
+
 } // namespace ns3
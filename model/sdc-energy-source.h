@@ -25,6 +25,8 @@
 #include "ns3/nstime.h"
 #include "ns3/event-id.h"
 #include "ns3/energy-source.h"
+#include "ns3/irradiance-timeline.h"
+#include <string>
 
 namespace ns3 {
 
@@ -32,6 +34,21 @@ namespace ns3 {
  * \ingroup energy
  * SdcEnergySource is a BasicEnergySource with Self-Discharge Current.
  *
+ * The remaining energy follows a closed form between two changes of the
+ * current drawn by the devices, so it is only computed when the current
+ * changes or the energy is queried. The time at which the low battery
+ * threshold will be crossed is solved for analytically, and a single event
+ * is scheduled at that time. Periodic updates can still be enabled with
+ * SdcPeriodicEnergyUpdateInterval, e.g., to sample the remaining energy
+ * trace; they stop while the source is depleted.
+ *
+ * If an SdcIrradianceFile is set, the source also harvests solar energy,
+ * with the power of the hourly irradiance times the area and efficiency of
+ * the harvester, up to its initial energy. The closed form then holds hour
+ * by hour, and is applied to each hour elapsed since the last update, so
+ * harvesting needs no events of its own. The next threshold crossing, low
+ * or high, is searched up to SdcPredictionHorizon ahead; if none is found,
+ * the search is done again from there.
  */
 class SdcEnergySource : public EnergySource
 {
@@ -101,7 +118,30 @@ public:
    */
   Time GetEnergyUpdateInterval (void) const;
 
+  /**
+   * \param totalCurrentA A constant current drawn by the devices, in Amperes.
+   * \returns The time from now until the low battery threshold is crossed,
+   * including self-discharge and harvesting, or Time::Max () if it is not
+   * crossed (within SdcPredictionHorizon, when harvesting).
+   */
+  Time GetTimeToDepletion (double totalCurrentA);
 
+  /**
+   * \returns The charge drawn by all the devices since the start, in
+   * Coulombs, self-discharge and harvesting excluded.
+   */
+  double GetTotalDrainedCharge (void);
+
+  /**
+   * \param path The irradiance timeline to harvest from, or an empty string
+   * not to harvest.
+   */
+  void SetIrradianceFile (std::string path);
+
+  /**
+   * \returns The irradiance timeline the source harvests from.
+   */
+  std::string GetIrradianceFile (void) const;
 
 private:
 
@@ -133,6 +173,60 @@ private:
    */
   void SdcCalculateRemainingEnergy(void);
 
+  /**
+   * Get the time it takes for the remaining energy to fall to a given level,
+   * if the current drawn by the devices stays the same.
+   *
+   * \param energyJ The level, in Joules.
+   * \param totalCurrentA The current drawn by the devices, in Amperes.
+   * \return The time, or Time::Max () if the level is never reached.
+   */
+  Time GetTimeToEnergy (double energyJ, double totalCurrentA) const;
+
+  /**
+   * Schedule an update for when the low battery threshold will be crossed.
+   *
+   * Devices update the source before they switch to their new state, so this
+   * runs after the update, once the new current is known.
+   */
+  void ScheduleThresholdEvent (void);
+
+  /**
+   * \param hour An hour of the irradiance timeline.
+   * \returns The power harvested during that hour, in Watts.
+   */
+  double GetHarvestedPowerW (uint64_t hour) const;
+
+  /**
+   * \param time A simulation time.
+   * \param hour The hour of the irradiance timeline at that time.
+   * \returns The end of that hour, in simulation time.
+   */
+  Time GetHourAt (Time time, uint64_t &hour) const;
+
+  /**
+   * Apply the closed form of the remaining energy over a time during which
+   * the net power drawn from the source does not change.
+   *
+   * \param energyJ The energy at the start, in Joules.
+   * \param netPowerW The power drawn by the devices, minus the power
+   * harvested, in Watts.
+   * \param seconds The duration.
+   * \return The energy at the end, in Joules.
+   */
+  double IntegrateEnergy (double energyJ, double netPowerW, double seconds) const;
+
+  /**
+   * Invert IntegrateEnergy.
+   *
+   * \param energyJ The energy at the start, in Joules.
+   * \param netPowerW The net power drawn from the source, in Watts.
+   * \param targetJ The energy to reach, in Joules.
+   * \return The time it takes to reach targetJ, in seconds, or a negative
+   * value if it is never reached.
+   */
+  double SolveEnergy (double energyJ, double netPowerW, double targetJ) const;
+
 private:
   double m_initialEnergyJ;                //!< initial energy, in Joules
   double m_supplyVoltageV;                //!< supply voltage, in Volts
@@ -145,9 +239,19 @@ private:
   bool m_depleted;
   TracedValue<double> m_remainingEnergyJ; //!< remaining energy, in Joules
   EventId m_energyUpdateEvent;            //!< energy update event
+  EventId m_thresholdEvent;               //!< update at the low threshold crossing
+  EventId m_predictionEvent;              //!< pending ScheduleThresholdEvent
   Time m_lastUpdateTime;                  //!< last update time
+  double m_drainedChargeC;                //!< charge drawn by the devices, in Coulombs
   Time m_energyUpdateInterval;            //!< energy update interval
   double m_sdcParameter;                  // how much energy will be in your battery after one month
+
+  std::string m_irradianceFile;           //!< the irradiance timeline, if harvesting
+  Ptr<const sigfox::IrradianceTimeline> m_irradiance; //!< the irradiance timeline, shared
+  double m_harvesterAreaM2;               //!< the area of the harvester
+  double m_harvesterEfficiency;           //!< the efficiency of the harvester
+  Time m_irradianceOffset;                //!< where the timeline starts, at time zero
+  Time m_predictionHorizon;               //!< how far threshold crossings are searched
 };
 
 } // namespace ns3
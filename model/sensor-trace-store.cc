@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/sensor-trace-store.h"
+#include "ns3/simulator.h"
+#include "ns3/fatal-error.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("SensorTraceStore");
+
+std::map<std::string, Ptr<SensorTraceStore> > &
+SensorTraceStore::GetStores (void)
+{
+  static std::map<std::string, Ptr<SensorTraceStore> > stores;
+  return stores;
+}
+
+Ptr<const SensorTraceStore>
+SensorTraceStore::Open (std::string path)
+{
+  NS_LOG_FUNCTION (path);
+
+  std::map<std::string, Ptr<SensorTraceStore> > &stores = GetStores ();
+  std::map<std::string, Ptr<SensorTraceStore> >::iterator it = stores.find (path);
+  if (it != stores.end ())
+    {
+      return it->second;
+    }
+
+  if (stores.empty ())
+    {
+      Simulator::ScheduleDestroy (&SensorTraceStore::Clear);
+    }
+
+  // The constructor is private, so Create<> cannot be used
+  Ptr<SensorTraceStore> store = Ptr<SensorTraceStore> (new SensorTraceStore (path), false);
+  stores[path] = store;
+  return store;
+}
+
+SensorTraceStore::SensorTraceStore (std::string path)
+  : m_file (path),
+    m_nSamples (0)
+{
+  NS_LOG_FUNCTION (this << path);
+
+  if (m_file.GetSize () % sizeof (int32_t) != 0)
+    {
+      NS_FATAL_ERROR ("Sensor trace " << path << " is not an array of 32 bit integers");
+    }
+
+  m_nSamples = m_file.GetSize () / sizeof (int32_t);
+  NS_LOG_DEBUG ("Mapped " << m_nSamples << " samples from " << path);
+}
+
+SensorTraceStore::~SensorTraceStore ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint32_t
+SensorTraceStore::GetNSamples (void) const
+{
+  return m_nSamples;
+}
+
+int32_t
+SensorTraceStore::GetSample (uint64_t index) const
+{
+  // Assemble the value byte by byte, so that the file reads the same on any
+  // host and no alignment is assumed
+  const uint8_t *p = m_file.GetData () + (index % m_nSamples) * sizeof (int32_t);
+  uint32_t value = static_cast<uint32_t> (p[0]) |
+    static_cast<uint32_t> (p[1]) << 8 |
+    static_cast<uint32_t> (p[2]) << 16 |
+    static_cast<uint32_t> (p[3]) << 24;
+  return static_cast<int32_t> (value);
+}
+
+void
+SensorTraceStore::Clear (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  GetStores ().clear ();
+}
+
+} // namespace sigfox
+} // namespace ns3
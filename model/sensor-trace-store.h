@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef SENSOR_TRACE_STORE_H
+#define SENSOR_TRACE_STORE_H
+
+#include "ns3/simple-ref-count.h"
+#include "ns3/ptr.h"
+#include "ns3/mapped-file.h"
+#include <stdint.h>
+#include <map>
+#include <string>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * A read-only series of sensor measurements, memory-mapped from a file.
+ *
+ * The file is a plain array of little-endian 32 bit signed integers, one per
+ * measurement, with no header (see data/sensor-trace.bin). Each file is
+ * mapped only once per simulation: all applications reading the same trace
+ * share the mapping, and only keep their own position in it.
+ */
+class SensorTraceStore : public SimpleRefCount<SensorTraceStore>
+{
+public:
+  ~SensorTraceStore ();
+
+  /**
+   * Get the store for a trace file, mapping it if it is not mapped yet.
+   *
+   * \param path The path of the file.
+   * \return The store, shared by all callers using the same path.
+   */
+  static Ptr<const SensorTraceStore> Open (std::string path);
+
+  /**
+   * Get the number of measurements in the trace.
+   */
+  uint32_t GetNSamples (void) const;
+
+  /**
+   * Get a measurement. The trace wraps around, so that any index is valid.
+   *
+   * \param index The index of the measurement.
+   * \return The measurement.
+   */
+  int32_t GetSample (uint64_t index) const;
+
+private:
+  /**
+   * Map a file.
+   *
+   * \param path The path of the file.
+   */
+  SensorTraceStore (std::string path);
+
+  /**
+   * Get the stores that are mapped, indexed by path.
+   */
+  static std::map<std::string, Ptr<SensorTraceStore> > &GetStores (void);
+
+  /**
+   * Release all stores. Scheduled to run when the simulation is destroyed.
+   */
+  static void Clear (void);
+
+  MappedFile m_file;    //!< The mapped file
+  uint32_t m_nSamples;  //!< The number of measurements
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* SENSOR_TRACE_STORE_H */
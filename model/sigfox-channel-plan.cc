@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/sigfox-channel-plan.h"
+#include "ns3/log.h"
+#include "ns3/abort.h"
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("SigfoxChannelPlan");
+
+SigfoxChannelPlan::SigfoxChannelPlan () :
+  m_startFrequencyHz (0),
+  m_endFrequencyHz (0),
+  m_dutyCycleWindow (Hours (1)),
+  m_rc (RC1)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SigfoxChannelPlan::AddSubBand (double firstFrequency, double lastFrequency,
+                               double dutyCycle, double maxTxPowerDbm)
+{
+  NS_LOG_FUNCTION (this << firstFrequency << lastFrequency << dutyCycle << maxTxPowerDbm);
+
+  AddSubBand (Create<SubBand> (firstFrequency, lastFrequency, dutyCycle, maxTxPowerDbm));
+}
+
+void
+SigfoxChannelPlan::AddSubBand (Ptr<SubBand> subBand)
+{
+  NS_LOG_FUNCTION (this << subBand);
+
+  m_subBands.push_back (subBand);
+}
+
+void
+SigfoxChannelPlan::SetFrequencyRange (double startFrequencyHz, double endFrequencyHz)
+{
+  NS_LOG_FUNCTION (this << startFrequencyHz << endFrequencyHz);
+
+  m_startFrequencyHz = startFrequencyHz;
+  m_endFrequencyHz = endFrequencyHz;
+}
+
+void
+SigfoxChannelPlan::SetDutyCycleWindow (Time window)
+{
+  NS_LOG_FUNCTION (this << window);
+
+  m_dutyCycleWindow = window;
+}
+
+void
+SigfoxChannelPlan::SetRadioConfiguration (enum SigfoxRadioConfiguration rc)
+{
+  NS_LOG_FUNCTION (this << rc);
+
+  m_rc = rc;
+}
+
+uint32_t
+SigfoxChannelPlan::GetNSubBands (void) const
+{
+  return m_subBands.size ();
+}
+
+Ptr<SubBand>
+SigfoxChannelPlan::GetSubBand (uint32_t id) const
+{
+  NS_ASSERT (id < m_subBands.size ());
+
+  return m_subBands[id];
+}
+
+uint32_t
+SigfoxChannelPlan::FindSubBand (double frequencyHz, uint32_t hint) const
+{
+  if (hint < m_subBands.size () && m_subBands[hint]->BelongsToSubBand (frequencyHz))
+    {
+      return hint;
+    }
+
+  // Get the SubBand this frequency belongs to
+  for (uint32_t id = 0; id < m_subBands.size (); id++)
+    {
+      if (m_subBands[id]->BelongsToSubBand (frequencyHz))
+        {
+          return id;
+        }
+    }
+
+  NS_LOG_ERROR ("Requested frequency: " << frequencyHz);
+  NS_ABORT_MSG ("Warning: frequency is outside any known SubBand.");
+
+  return 0;
+}
+
+double
+SigfoxChannelPlan::GetAirTimeCapacity (uint32_t id) const
+{
+  return GetSubBand (id)->GetDutyCycle () * m_dutyCycleWindow.GetSeconds ();
+}
+
+double
+SigfoxChannelPlan::GetStartFrequency (void) const
+{
+  return m_startFrequencyHz;
+}
+
+double
+SigfoxChannelPlan::GetEndFrequency (void) const
+{
+  return m_endFrequencyHz;
+}
+
+Time
+SigfoxChannelPlan::GetDutyCycleWindow (void) const
+{
+  return m_dutyCycleWindow;
+}
+
+enum SigfoxRadioConfiguration
+SigfoxChannelPlan::GetRadioConfiguration (void) const
+{
+  return m_rc;
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SIGFOX_CHANNEL_PLAN_H
+#define SIGFOX_CHANNEL_PLAN_H
+
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/sub-band.h"
+#include "ns3/sigfox-radio-configuration.h"
+#include <vector>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * The channel plan of a region: the SubBands with their duty cycle and power
+ * limits, and the range of frequencies uplink messages are sent in.
+ *
+ * A channel plan is built once and then shared by all the devices of a
+ * region through LogicalSigfoxChannelHelper, which only keeps the state that
+ * is specific to each device. A plan that has been handed to a device must
+ * not be modified anymore: LogicalSigfoxChannelHelper makes a private copy
+ * of a shared plan before changing it.
+ */
+class SigfoxChannelPlan : public SimpleRefCount<SigfoxChannelPlan>
+{
+public:
+  SigfoxChannelPlan ();
+
+  /**
+   * Add a new SubBand to this plan.
+   *
+   * \param firstFrequency The first frequency of the subband, in Hz.
+   * \param lastFrequency The last frequency of the subband, in Hz.
+   * \param dutyCycle The duty cycle that needs to be enforced on this subband.
+   * \param maxTxPowerDbm The maximum transmission power [dBm] that can be used
+   * on this SubBand.
+   */
+  void AddSubBand (double firstFrequency, double lastFrequency,
+                   double dutyCycle, double maxTxPowerDbm);
+
+  /**
+   * Add a new SubBand to this plan.
+   *
+   * \param subBand A pointer to the SubBand that needs to be added.
+   */
+  void AddSubBand (Ptr<SubBand> subBand);
+
+  /**
+   * Set the range uplink frequencies are drawn from.
+   *
+   * \param startFrequencyHz The lowest frequency, in Hz.
+   * \param endFrequencyHz The highest frequency, in Hz.
+   */
+  void SetFrequencyRange (double startFrequencyHz, double endFrequencyHz);
+
+  /**
+   * Set the window over which the duty cycle of SubBands is enforced.
+   *
+   * \param window The duty cycle window.
+   */
+  void SetDutyCycleWindow (Time window);
+
+  /**
+   * Set the radio configuration devices using this plan operate with.
+   *
+   * \param rc The radio configuration.
+   */
+  void SetRadioConfiguration (enum SigfoxRadioConfiguration rc);
+
+  /**
+   * Get the number of SubBands in this plan.
+   */
+  uint32_t GetNSubBands (void) const;
+
+  /**
+   * Get a SubBand by index. SubBands are numbered in the order they were
+   * added.
+   *
+   * \param id The index of the SubBand.
+   * \return The SubBand, which must not be modified.
+   */
+  Ptr<SubBand> GetSubBand (uint32_t id) const;
+
+  /**
+   * Get the index of the SubBand a frequency belongs to.
+   *
+   * \param frequencyHz The frequency we want to check.
+   * \param hint The index of a SubBand that is likely to match, which is
+   * checked first.
+   * \return The index of the SubBand the frequency belongs to.
+   */
+  uint32_t FindSubBand (double frequencyHz, uint32_t hint) const;
+
+  /**
+   * Get the airtime, in seconds, a device can accumulate on a SubBand, i.e.,
+   * the duty cycle of the SubBand times the duty cycle window.
+   *
+   * \param id The index of the SubBand.
+   */
+  double GetAirTimeCapacity (uint32_t id) const;
+
+  double GetStartFrequency (void) const; //!< \return The lowest uplink frequency
+  double GetEndFrequency (void) const;   //!< \return The highest uplink frequency
+  Time GetDutyCycleWindow (void) const;  //!< \return The duty cycle window
+  enum SigfoxRadioConfiguration GetRadioConfiguration (void) const; //!< \return The radio configuration
+
+private:
+  std::vector<Ptr<SubBand> > m_subBands; //!< The SubBands, indexed by id
+  double m_startFrequencyHz;             //!< The lowest uplink frequency
+  double m_endFrequencyHz;               //!< The highest uplink frequency
+  Time m_dutyCycleWindow;                //!< The duty cycle window
+  enum SigfoxRadioConfiguration m_rc;    //!< The radio configuration
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* SIGFOX_CHANNEL_PLAN_H */
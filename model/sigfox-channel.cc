@@ -26,6 +26,7 @@
 #include "ns3/simulator.h"
 #include "ns3/end-point-sigfox-phy.h"
 #include "ns3/gateway-sigfox-phy.h"
+#include "ns3/sigfox-tag.h"
 #include <algorithm>
 
 namespace ns3 {
@@ -108,10 +109,10 @@ SigfoxChannel::GetDevice (std::size_t i) const
 void
 SigfoxChannel::Send (Ptr< SigfoxPhy > sender, Ptr< Packet > packet,
                    double txPowerDbm, SigfoxTxParameters txParams,
-                   Time duration, double frequencyMHz) const
+                   Time duration, double frequencyHz) const
 {
   NS_LOG_FUNCTION (this << sender << packet << txPowerDbm << txParams <<
-                   duration << frequencyMHz);
+                   duration << frequencyHz);
 
   // Get the mobility model of the sender
   Ptr<MobilityModel> senderMobility = sender->GetMobility ()->GetObject<MobilityModel> ();
@@ -169,7 +170,7 @@ SigfoxChannel::Send (Ptr< SigfoxPhy > sender, Ptr< Packet > packet,
           SigfoxChannelParameters parameters;
           parameters.rxPowerDbm = rxPowerDbm;
           parameters.duration = duration;
-          parameters.frequencyMHz = frequencyMHz;
+          parameters.frequencyHz = frequencyHz;
 
           // Schedule the receive event
           NS_LOG_INFO ("Scheduling reception of the packet");
@@ -179,14 +180,101 @@ SigfoxChannel::Send (Ptr< SigfoxPhy > sender, Ptr< Packet > packet,
     }
 }
 
+void
+SigfoxChannel::SendBurst (Ptr<SigfoxPhy> sender, Ptr<Packet> packet,
+                          double txPowerDbm, SigfoxTxParameters txParams,
+                          Time duration, const SigfoxBurstParameters &burst) const
+{
+  NS_LOG_FUNCTION (this << sender << packet << txPowerDbm << txParams <<
+                   duration << burst.startOffsets.size ());
+
+  NS_ASSERT (burst.startOffsets.size () == burst.frequenciesHz.size ());
+
+  uint32_t nRepetitions = burst.startOffsets.size ();
+  for (uint32_t rep = 1; rep < nRepetitions; rep++)
+    {
+      NS_ASSERT_MSG (burst.startOffsets[rep] >= burst.startOffsets[rep - 1] + duration,
+                     "Repetitions of a burst cannot overlap");
+    }
+
+  // Get the mobility model of the sender
+  Ptr<MobilityModel> senderMobility = sender->GetMobility ()->GetObject<MobilityModel> ();
+
+  NS_ASSERT (senderMobility != 0);     // Make sure it's available
+
+  // The first repetition starts now, the others are started before they
+  // reach any of the PHYs, since they are scheduled first
+  StartBurstRepetition (packet, 0, burst.frequenciesHz[0]);
+  for (uint32_t rep = 1; rep < nRepetitions; rep++)
+    {
+      Simulator::Schedule (burst.startOffsets[rep], &SigfoxChannel::StartBurstRepetition,
+                           this, packet, rep, burst.frequenciesHz[rep]);
+    }
+
+  NS_LOG_INFO ("Starting cycle over all " << m_phyList.size () << " PHYs");
+
+  // Cycle over all registered PHYs
+  uint32_t j = 0;
+  std::vector<Ptr<SigfoxPhy> >::const_iterator i;
+  for (i = m_phyList.begin (); i != m_phyList.end (); i++, j++)
+    {
+      // Do not deliver to the sender (*i is the current PHY)
+      if (sender != (*i))
+        {
+          // Propagation is the same for all repetitions
+          Ptr<MobilityModel> receiverMobility = (*i)->GetMobility ()->
+            GetObject<MobilityModel> ();
+          Time delay = m_delay->GetDelay (senderMobility, receiverMobility);
+          double rxPowerDbm = GetRxPower (txPowerDbm, senderMobility,
+                                          receiverMobility);
+
+          Ptr<NetDevice> dstNetDevice = m_phyList[j]->GetDevice ();
+          uint32_t dstNode = 0;
+          if (dstNetDevice != 0)
+            {
+              dstNode = dstNetDevice->GetNode ()->GetId ();
+            }
+
+          SigfoxChannelParameters parameters;
+          parameters.rxPowerDbm = rxPowerDbm;
+          parameters.duration = duration;
+
+          for (uint32_t rep = 0; rep < nRepetitions; rep++)
+            {
+              parameters.frequencyHz = burst.frequenciesHz[rep];
+              Simulator::ScheduleWithContext (dstNode, delay + burst.startOffsets[rep],
+                                              &SigfoxChannel::Receive,
+                                              this, j, packet, parameters);
+            }
+        }
+    }
+}
+
+void
+SigfoxChannel::StartBurstRepetition (Ptr<Packet> packet, uint32_t repetition,
+                                     double frequencyHz) const
+{
+  NS_LOG_FUNCTION (this << packet << repetition << frequencyHz);
+
+  SigfoxTag tag;
+  packet->PeekPacketTag (tag);
+  tag.SetRepetitionNumber (repetition);
+  tag.SetFrequency (frequencyHz);
+  packet->ReplacePacketTag (tag);
+
+  // Fire the trace source for sent packet
+  m_packetSent (packet);
+}
+
 void
 SigfoxChannel::Receive (uint32_t i, Ptr<Packet> packet,
                       SigfoxChannelParameters parameters) const
 {
   NS_LOG_FUNCTION (this << i << packet << parameters);
 
-  // Call the appropriate PHY instance to let it begin reception
-  m_phyList[i]->StartReceive (packet, parameters.rxPowerDbm, parameters.duration, parameters.frequencyMHz);
+  // Call the appropriate PHY instance to let it begin reception. Each
+  // receiver gets its own copy, whose tags it is free to change.
+  m_phyList[i]->StartReceive (packet->Copy (), parameters.rxPowerDbm, parameters.duration, parameters.frequencyHz);
 }
 
 double
@@ -200,7 +288,7 @@ std::ostream &operator << (std::ostream &os, const SigfoxChannelParameters &para
 {
   os << "(rxPowerDbm: " << params.rxPowerDbm <<
     ", durationSec: " << params.duration.GetSeconds () <<
-    ", frequencyMHz: " << params.frequencyMHz << ")";
+    ", frequencyHz: " << params.frequencyHz << ")";
   return os;
 }
 }
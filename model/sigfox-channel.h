@@ -42,6 +42,7 @@ namespace sigfox {
 
 class SigfoxPhy;
 struct SigfoxTxParameters;
+struct SigfoxBurstParameters;
 
 /**
  * A struct that holds meaningful parameters for transmission on a
@@ -51,7 +52,7 @@ struct SigfoxChannelParameters
 {
   double rxPowerDbm;     //!< The reception power.
   Time duration;     //!< The duration of the transmission.
-  double frequencyMHz;     //!< The frequency [MHz] of this transmission.
+  double frequencyHz;     //!< The frequency [Hz] of this transmission.
 };
 
 /**
@@ -125,7 +126,7 @@ public:
     * \param txPowerDbm The power of the transmission.
     * \param txParams The set of parameters that are used by the transmitter.
     * \param duration The on-air duration of this packet.
-    * \param frequencyMHz The frequency this transmission will happen at.
+    * \param frequencyHz The frequency this transmission will happen at.
     *
     * \internal
     *
@@ -133,9 +134,31 @@ public:
     * that performs the actual call to the PHY's StartReceive function.
     */
   void Send (Ptr<SigfoxPhy> sender, Ptr<Packet> packet, double txPowerDbm,
-             SigfoxTxParameters txParams, Time duration, double frequencyMHz)
+             SigfoxTxParameters txParams, Time duration, double frequencyHz)
   const;
 
+  /**
+    * Send all the repetitions of a message in the channel.
+    *
+    * This is equivalent to calling Send for each repetition at its start
+    * offset, but the propagation to each connected PHY is only computed once
+    * for the whole burst, and all repetitions share the same packet. Before
+    * each repetition goes out, the SigfoxTag of the packet is updated with
+    * its repetition number and frequency: this relies on repetitions not
+    * overlapping in time, and on propagation delays being shorter than the
+    * gap between repetitions.
+    *
+    * \param sender The phy that is sending this burst.
+    * \param packet The PHY layer packet shared by all repetitions.
+    * \param txPowerDbm The power of the transmission.
+    * \param txParams The set of parameters that are used by the transmitter.
+    * \param duration The on-air duration of each repetition.
+    * \param burst The start offset and frequency of each repetition.
+    */
+  void SendBurst (Ptr<SigfoxPhy> sender, Ptr<Packet> packet, double txPowerDbm,
+                  SigfoxTxParameters txParams, Time duration,
+                  const SigfoxBurstParameters &burst) const;
+
   /**
     * Compute the received power when transmitting from a point to another one.
     *
@@ -166,6 +189,17 @@ private:
   void Receive (uint32_t i, Ptr<Packet> packet,
                 SigfoxChannelParameters parameters) const;
 
+  /**
+    * Private method that is scheduled by SigfoxChannel's SendBurst method at
+    * the start of each repetition of the burst, before it reaches any PHY.
+    *
+    * \param packet The packet shared by the repetitions of the burst.
+    * \param repetition The number of the repetition that is starting.
+    * \param frequencyHz The frequency of the repetition that is starting.
+    */
+  void StartBurstRepetition (Ptr<Packet> packet, uint32_t repetition,
+                             double frequencyHz) const;
+
   /**
     * The vector containing the PHYs that are currently connected to the
     * channel.
@@ -34,12 +34,12 @@ NS_LOG_COMPONENT_DEFINE ("SigfoxInterferenceHelper");
  ***************************************/
 
 // Event Constructor
-SigfoxInterferenceHelper::Event::Event (Time duration, double rxPowerdBm, Ptr<Packet> packet, double frequencyMHz)
+SigfoxInterferenceHelper::Event::Event (Time duration, double rxPowerdBm, Ptr<Packet> packet, double frequencyHz)
     : m_startTime (Simulator::Now ()),
       m_endTime (m_startTime + duration),
       m_rxPowerdBm (rxPowerdBm),
       m_packet (packet),
-      m_frequencyMHz (frequencyMHz)
+      m_frequencyHz (frequencyHz)
 {
   // NS_LOG_FUNCTION_NOARGS ();
 }
@@ -84,14 +84,14 @@ SigfoxInterferenceHelper::Event::GetPacket (void) const
 double
 SigfoxInterferenceHelper::Event::GetFrequency (void) const
 {
-  return m_frequencyMHz;
+  return m_frequencyHz;
 }
 
 void
 SigfoxInterferenceHelper::Event::Print (std::ostream &stream) const
 {
   stream << "(" << m_startTime.GetSeconds () << " s - " << m_endTime.GetSeconds () << "s"
-         << ", " << m_rxPowerdBm << " dBm, " << m_frequencyMHz << " MHz";
+         << ", " << m_rxPowerdBm << " dBm, " << m_frequencyHz << " Hz";
 }
 
 std::ostream &
@@ -127,14 +127,14 @@ Time SigfoxInterferenceHelper::oldEventThreshold = Seconds (2);
 
 Ptr<SigfoxInterferenceHelper::Event>
 SigfoxInterferenceHelper::Add (Time duration, double rxPower, Ptr<Packet> packet,
-                               double frequencyMHz)
+                               double frequencyHz)
 {
 
-  NS_LOG_FUNCTION (this << duration.GetSeconds () << rxPower << packet << frequencyMHz);
+  NS_LOG_FUNCTION (this << duration.GetSeconds () << rxPower << packet << frequencyHz);
 
   // Create an event based on the parameters
   Ptr<SigfoxInterferenceHelper::Event> event =
-      Create<SigfoxInterferenceHelper::Event> (duration, rxPower, packet, frequencyMHz);
+      Create<SigfoxInterferenceHelper::Event> (duration, rxPower, packet, frequencyHz);
 
   // Add the event to the list
   m_events.push_back (event);
@@ -52,7 +52,7 @@ public:
   {
 
   public:
-    Event (Time duration, double rxPowerdBm, Ptr<Packet> packet, double frequencyMHz);
+    Event (Time duration, double rxPowerdBm, Ptr<Packet> packet, double frequencyHz);
     ~Event ();
 
     /**
@@ -114,7 +114,7 @@ public:
     /**
      * The frequency this event was on.
      */
-    double m_frequencyMHz;
+    double m_frequencyHz;
   };
 
   static TypeId GetTypeId (void);
@@ -128,11 +128,11 @@ public:
    * \param duration the duration of the packet.
    * \param rxPower the received power in dBm.
    * \param packet The packet carried by this transmission.
-   * \param frequencyMHz The frequency this event was sent at.
+   * \param frequencyHz The frequency this event was sent at.
    *
    * \return the newly created event
    */
-  Ptr<SigfoxInterferenceHelper::Event> Add (Time duration, double rxPower, Ptr<Packet> packet, double frequencyMHz);
+  Ptr<SigfoxInterferenceHelper::Event> Add (Time duration, double rxPower, Ptr<Packet> packet, double frequencyHz);
 
   /**
    * Get a list of the interferers currently registered at this
@@ -55,7 +55,8 @@ SigfoxMac::GetTypeId (void)
   return tid;
 }
 
-SigfoxMac::SigfoxMac ()
+SigfoxMac::SigfoxMac () :
+  m_channelHelper (CreateObject<LogicalSigfoxChannelHelper> ())
 {
   NS_LOG_FUNCTION (this);
 }
@@ -95,18 +96,26 @@ SigfoxMac::SetPhy (Ptr<SigfoxPhy> phy)
   m_phy->SetTxFinishedCallback (MakeCallback (&SigfoxMac::TxFinished, this));
 }
 
-LogicalSigfoxChannelHelper
+Ptr<LogicalSigfoxChannelHelper>
 SigfoxMac::GetLogicalSigfoxChannelHelper (void)
 {
   return m_channelHelper;
 }
 
 void
-SigfoxMac::SetLogicalSigfoxChannelHelper (LogicalSigfoxChannelHelper helper)
+SigfoxMac::SetLogicalSigfoxChannelHelper (Ptr<LogicalSigfoxChannelHelper> helper)
 {
   m_channelHelper = helper;
 }
 
+int64_t
+SigfoxMac::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  return m_channelHelper->AssignStreams (stream);
+}
+
 double
 SigfoxMac::GetBandwidthFromDataRate (uint8_t dataRate)
 {
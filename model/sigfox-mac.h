@@ -113,14 +113,27 @@ public:
    *
    * \return The instance of LogicalSigfoxChannelHelper that this MAC is using.
    */
-  LogicalSigfoxChannelHelper GetLogicalSigfoxChannelHelper (void);
+  Ptr<LogicalSigfoxChannelHelper> GetLogicalSigfoxChannelHelper (void);
 
   /**
    * Set the LogicalSigfoxChannelHelper this MAC instance will use.
    *
+   * Each MAC needs its own instance, since it holds the duty cycle state of
+   * the device. To share the channel plan between devices, use
+   * LogicalSigfoxChannelHelper::SetChannelPlan instead.
+   *
    * \param helper The instance of the helper to use.
    */
-  void SetLogicalSigfoxChannelHelper (LogicalSigfoxChannelHelper helper);
+  void SetLogicalSigfoxChannelHelper (Ptr<LogicalSigfoxChannelHelper> helper);
+
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by this MAC.
+   *
+   * \param stream The first stream index to use.
+   * \return The number of stream indices assigned by this MAC.
+   */
+  virtual int64_t AssignStreams (int64_t stream);
 
   /**
    * Get the BW corresponding to a data rate, based on this MAC's region
@@ -227,7 +240,7 @@ protected:
   /**
    * The LogicalSigfoxChannelHelper instance that is assigned to this MAC.
    */
-  LogicalSigfoxChannelHelper m_channelHelper;
+  Ptr<LogicalSigfoxChannelHelper> m_channelHelper;
 
   /**
    * A vector holding the bandwidth each Data Rate corresponds to.
@@ -20,6 +20,7 @@
 
 #include "ns3/sigfox-phy.h"
 #include "ns3/log.h"
+#include "ns3/abort.h"
 #include "ns3/simulator.h"
 #include <algorithm>
 
@@ -160,36 +161,25 @@ SigfoxPhy::GetOnAirTime (Ptr<Packet> packet, SigfoxTxParameters txParams)
 
   NS_LOG_FUNCTION (packet << txParams);
 
-  NS_LOG_DEBUG ("Packet size: " << packet->GetSize());
+  uint32_t size = packet->GetSize ();
+  NS_LOG_DEBUG ("Packet size: " << size);
 
-  // We use the following table to compute the duration of a frame based on the
-  // payload length, since Sigfox will automatically pad the payload to reach
-  // one of several pre-defined possible configurations
-  //
-  // | Payload length  | RC1/RC3/RC5 | RC2/RC4 |
-  // |-----------------+-------------+---------|
-  // | < 1 bit         | 1.1 seconds | 190 ms  |
-  // | 2 bits - 1 byte | 1.2 seconds | 200 ms  |
-  // | 2 - 4 bytes     | 1.45 s      | 250 ms  |
-  // | 5 - 8 bytes     | 1.75 s      | 300 ms  |
-  // | 9 - 12 bytes    | 2 s         | 350 ms  |
-
-  if (packet->GetSize() == 0)
-    return Seconds (1.1);
-
-  if (packet->GetSize() <= 1)
-    return Seconds (1.2);
-
-  if (packet->GetSize() <= 4)
-    return Seconds (1.45);
+  if (txParams.downlink)
+    {
+      return MilliSeconds (GetRadioConfigurationParameters (txParams.rc).
+                           downlinkFrameDurationMs);
+    }
 
-  if (packet->GetSize() <= 8)
-    return Seconds (1.75);
-  
-  if (packet->GetSize() <= 12)
-    return Seconds (2);
+  // Sigfox automatically pads the payload to reach one of several
+  // pre-defined lengths, so the duration of a frame only depends on the
+  // payload class and on the radio configuration (see
+  // sigfox-radio-configuration.h)
+  NS_ABORT_MSG_IF (size > maxUplinkPayloadSize,
+                   "Sigfox payloads are at most " << maxUplinkPayloadSize <<
+                   " bytes, got " << size);
 
-  return Seconds (0);
+  return MilliSeconds (GetRadioConfigurationParameters (txParams.rc).
+                       frameDurationMs[payloadClassOfSize[size]]);
 }
 
 std::ostream &
@@ -30,7 +30,9 @@
 #include "ns3/sigfox-channel.h"
 #include "ns3/net-device.h"
 #include "ns3/sigfox-interference-helper.h"
+#include "ns3/sigfox-radio-configuration.h"
 #include <list>
+#include <vector>
 
 namespace ns3 {
 namespace sigfox {
@@ -45,6 +47,8 @@ struct SigfoxTxParameters
 {
   double bandwidthHz = 100;     //!< Bandwidth in Hz
   uint32_t nPreamble = 8;     //!< Number of preamble symbols
+  enum SigfoxRadioConfiguration rc = RC1; //!< Radio configuration
+  bool downlink = false;        //!< Whether this is a downlink frame
 };
 
 /**
@@ -52,6 +56,17 @@ struct SigfoxTxParameters
  */
 std::ostream &operator << (std::ostream &os, const SigfoxTxParameters &params);
 
+/**
+ * Structure describing the repetitions of a message that are handed to the
+ * PHY and to the channel at once. All repetitions carry the same payload,
+ * and only differ in start time and carrier frequency.
+ */
+struct SigfoxBurstParameters
+{
+  std::vector<Time> startOffsets;     //!< Start of each repetition, relative to the first
+  std::vector<double> frequenciesHz;     //!< Carrier frequency of each repetition
+};
+
 /**
  * \ingroup sigfox
  *
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SIGFOX_RADIO_CONFIGURATION_H
+#define SIGFOX_RADIO_CONFIGURATION_H
+
+#include <stdint.h>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * The Sigfox radio configurations, each describing the radio parameters of a
+ * group of regions.
+ */
+enum SigfoxRadioConfiguration
+{
+  RC1 = 0, //!< Europe, Middle East and Africa
+  RC2,     //!< USA, Canada and Mexico
+  RC3,     //!< Japan
+  RC4,     //!< Latin America and Asia Pacific
+  RC5,     //!< South Korea
+  RC6,     //!< India
+  RC7      //!< Russia
+};
+
+/**
+ * The number of radio configurations.
+ */
+constexpr uint32_t nRadioConfigurations = 7;
+
+/**
+ * Sigfox pads the payload to one of several predefined lengths. The payload
+ * class is the index of the padded length:
+ *
+ * | Payload class | Payload length  |
+ * |---------------+-----------------|
+ * | 0             | < 1 bit         |
+ * | 1             | 2 bits - 1 byte |
+ * | 2             | 2 - 4 bytes     |
+ * | 3             | 5 - 8 bytes     |
+ * | 4             | 9 - 12 bytes    |
+ */
+constexpr uint32_t nPayloadClasses = 5;
+
+/**
+ * The largest uplink payload, in bytes.
+ */
+constexpr uint32_t maxUplinkPayloadSize = 12;
+
+/**
+ * The payload class of each payload size, indexed by size in bytes.
+ */
+constexpr uint8_t payloadClassOfSize[maxUplinkPayloadSize + 1] =
+  {0, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4};
+
+/**
+ * The radio parameters of a radio configuration.
+ */
+struct SigfoxRadioConfigurationParameters
+{
+  double uplinkCenterFrequencyHz;   //!< Center of the uplink macro channel
+  double downlinkCenterFrequencyHz; //!< Center of the downlink channel
+  double macroChannelWidthHz;       //!< Width of the uplink macro channel
+  double uplinkChannelSpacingHz;    //!< Spacing of the uplink channel grid
+  double uplinkGuardHz;             //!< Gap in the middle of the channel grid
+  uint32_t uplinkBitRate;           //!< Uplink bit rate, in bps
+  uint32_t downlinkBitRate;         //!< Downlink bit rate, in bps
+  double maxEirpDbm;                //!< Maximum uplink EIRP
+  double dutyCycle;                 //!< Uplink duty cycle, 1 if unrestricted
+  uint16_t frameDurationMs[nPayloadClasses]; //!< Frame duration per payload class
+  double downlinkMaxEirpDbm;        //!< Maximum downlink EIRP
+  double downlinkDutyCycle;         //!< Downlink duty cycle, 1 if unrestricted
+  uint16_t downlinkFrameDurationMs; //!< Duration of a downlink frame
+};
+
+/**
+ * The width of the sub-band downlinks are sent in. In RC1, this is the ETSI
+ * 869.4 - 869.65 MHz band, where gateways can transmit with a 10% duty cycle.
+ */
+constexpr double downlinkSubBandWidthHz = 250e3;
+
+/**
+ * The parameters of each radio configuration, indexed by
+ * SigfoxRadioConfiguration.
+ *
+ * Frame durations are the same for all configurations with the same uplink
+ * bit rate. The uplink channel grid is made of two blocks of 180 channels
+ * on either side of the center of the macro channel, separated by a guard
+ * band where the macro channel is wide enough. With 600 bps the spacing is
+ * reduced to 500 Hz so that the grid still fits in the macro channel.
+ * Downlink frames carry a fixed 8 bytes payload, for about 224 bits sent at
+ * 600 bps.
+ */
+constexpr SigfoxRadioConfigurationParameters radioConfigurations[nRadioConfigurations] =
+{
+  // RC1
+  {868.130e6, 869.525e6, 192e3, 100, 4e3, 100, 600, 16, 0.01, {1100, 1200, 1450, 1750, 2000}, 27, 0.1, 373},
+  // RC2
+  {902.200e6, 905.200e6, 192e3, 500, 4e3, 600, 600, 24, 1, {190, 200, 250, 300, 350}, 30, 1, 373},
+  // RC3
+  {923.200e6, 922.200e6, 36e3, 100, 0, 100, 600, 16, 1, {1100, 1200, 1450, 1750, 2000}, 16, 1, 373},
+  // RC4
+  {920.800e6, 922.300e6, 192e3, 500, 4e3, 600, 600, 24, 1, {190, 200, 250, 300, 350}, 30, 1, 373},
+  // RC5
+  {923.300e6, 922.300e6, 36e3, 100, 0, 100, 600, 14, 1, {1100, 1200, 1450, 1750, 2000}, 23, 1, 373},
+  // RC6
+  {865.200e6, 866.300e6, 36e3, 100, 0, 100, 600, 16, 1, {1100, 1200, 1450, 1750, 2000}, 30, 1, 373},
+  // RC7
+  {868.800e6, 869.100e6, 36e3, 100, 0, 100, 600, 16, 0.01, {1100, 1200, 1450, 1750, 2000}, 27, 0.1, 373}
+};
+
+/**
+ * Get the parameters of a radio configuration.
+ *
+ * \param rc The radio configuration.
+ * \return The parameters of the radio configuration.
+ */
+inline const SigfoxRadioConfigurationParameters &
+GetRadioConfigurationParameters (enum SigfoxRadioConfiguration rc)
+{
+  return radioConfigurations[rc];
+}
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* SIGFOX_RADIO_CONFIGURATION_H */
@@ -76,6 +76,18 @@ SigfoxRadioEnergyModel::SigfoxRadioEnergyModel ()
   NS_LOG_FUNCTION (this);
   m_currentState = EndPointSigfoxPhy::SLEEP; // initially STANDBY
   m_lastUpdateTime = Seconds (0.0);
+  m_timelineActive = false;
+  m_timelineCurrentA = 0.0;
+  m_timelineDuration = 0.0;
+  m_txPowerDbm = 0.0;
+  for (uint32_t i = 0; i < nStates; i++)
+    {
+      m_timelineSeconds[i] = 0.0;
+      m_timelineEnergy[i] = 0.0;
+      m_stateSeconds[i] = 0.0;
+      m_stateEnergy[i] = 0.0;
+      m_stateTransitions[i] = 0;
+    }
   m_nPendingChangeState = 0;
   m_isSupersededChangeState = false;
   m_energyDepletionCallback.Nullify ();
@@ -109,6 +121,14 @@ SigfoxRadioEnergyModel::GetTotalEnergyConsumption (void) const
   return m_totalEnergyConsumption;
 }
 
+double
+SigfoxRadioEnergyModel::GetTotalEnergyConsumptionUntilNow (void) const
+{
+  NS_LOG_FUNCTION (this);
+  Time duration = Simulator::Now () - m_lastUpdateTime;
+  return m_totalEnergyConsumption + duration.GetSeconds () * DoGetCurrentA ();
+}
+
 double
 SigfoxRadioEnergyModel::GetStandbyCurrentA (void) const
 {
@@ -172,6 +192,33 @@ SigfoxRadioEnergyModel::GetCurrentState (void) const
   return m_currentState;
 }
 
+Time
+SigfoxRadioEnergyModel::GetStateTime (EndPointSigfoxPhy::State state) const
+{
+  NS_LOG_FUNCTION (this << state);
+  double stateSeconds[nStates] = {0};
+  double stateEnergy[nStates] = {0};
+  AccountElapsed ((Simulator::Now () - m_lastUpdateTime).GetSeconds (), stateSeconds, stateEnergy);
+  return Seconds (m_stateSeconds[state] + stateSeconds[state]);
+}
+
+double
+SigfoxRadioEnergyModel::GetStateEnergyConsumption (EndPointSigfoxPhy::State state) const
+{
+  NS_LOG_FUNCTION (this << state);
+  double stateSeconds[nStates] = {0};
+  double stateEnergy[nStates] = {0};
+  AccountElapsed ((Simulator::Now () - m_lastUpdateTime).GetSeconds (), stateSeconds, stateEnergy);
+  return m_stateEnergy[state] + stateEnergy[state];
+}
+
+uint64_t
+SigfoxRadioEnergyModel::GetStateTransitions (EndPointSigfoxPhy::State state) const
+{
+  NS_LOG_FUNCTION (this << state);
+  return m_stateTransitions[state];
+}
+
 void
 SigfoxRadioEnergyModel::SetEnergyDepletionCallback (SigfoxRadioEnergyDepletionCallback callback)
 {
@@ -203,6 +250,7 @@ SigfoxRadioEnergyModel::SetTxCurrentModel (Ptr<SigfoxTxCurrentModel> model)
 void
 SigfoxRadioEnergyModel::SetTxCurrentFromModel (double txPowerDbm)
 {
+  m_txPowerDbm = txPowerDbm;
   if (m_txCurrentModel)
     {
       m_txCurrentA = m_txCurrentModel->CalcTxCurrent (txPowerDbm);
@@ -231,7 +279,7 @@ SigfoxRadioEnergyModel::ChangeState (int newState)
       dd = duration.GetSeconds ();
       break;
     case EndPointSigfoxPhy::TX:
-      energyToDecrease = duration.GetSeconds () * m_txCurrentA; // * supplyVoltage;
+      energyToDecrease = GetTxCharge (duration); // * supplyVoltage;
       xx = m_txCurrentA;
       dd = duration.GetSeconds ();
       break;
@@ -249,6 +297,13 @@ SigfoxRadioEnergyModel::ChangeState (int newState)
       NS_FATAL_ERROR ("SigfoxRadioEnergyModel:Undefined radio state: " << m_currentState);
     }
 
+  if (m_timelineActive)
+    {
+      // We are leaving a PHY timeline: its charge is accounted for with the
+      // average current we computed when it started.
+      energyToDecrease = duration.GetSeconds () * m_timelineCurrentA;
+    }
+
   // new sate current
   switch (newState)
     {
@@ -269,6 +324,7 @@ SigfoxRadioEnergyModel::ChangeState (int newState)
     }
   // update total energy consumption
   m_totalEnergyConsumption += energyToDecrease;
+  AccountElapsed (duration.GetSeconds (), m_stateSeconds, m_stateEnergy);
 
   // update last update time stamp
   m_lastUpdateTime = Simulator::Now ();
@@ -287,8 +343,17 @@ SigfoxRadioEnergyModel::ChangeState (int newState)
 
   if (!m_isSupersededChangeState)
     {
+      if (newState != m_currentState)
+        {
+          m_stateTransitions[newState]++;
+        }
+      if (newState == EndPointSigfoxPhy::TX)
+        {
+          m_txStartTime = Simulator::Now ();
+        }
       // update current state & last update time stamp
       SetSigfoxRadioState ((EndPointSigfoxPhy::State) newState);
+      m_timelineActive = false;
       m_systemcurrent = xx;
       // some debug message
       NS_LOG_DEBUG ("SigfoxRadioEnergyModel:Total energy consumption is "
@@ -304,6 +369,58 @@ SigfoxRadioEnergyModel::ChangeState (int newState)
   m_nPendingChangeState--;
 }
 
+void
+SigfoxRadioEnergyModel::NotifyPhyTimelineStart (const EndPointSigfoxPhy::Timeline &timeline)
+{
+  NS_LOG_FUNCTION (this << timeline.size ());
+
+  // Close whatever state we were in before the timeline
+  int firstState = timeline.front ().state;
+  SigfoxRadioEnergyModel::ChangeState (firstState);
+  if (m_currentState != firstState)
+    {
+      // The source was depleted, and the PHY left the timeline already
+      return;
+    }
+
+  double charge = 0;
+  double totalDuration = 0;
+  for (uint32_t i = 0; i < nStates; i++)
+    {
+      m_timelineSeconds[i] = 0.0;
+      m_timelineEnergy[i] = 0.0;
+    }
+  for (EndPointSigfoxPhy::Timeline::const_iterator it = timeline.begin ();
+       it != timeline.end (); it++)
+    {
+      double segmentCharge;
+      if (it->state == EndPointSigfoxPhy::TX && m_txCurrentModel)
+        {
+          segmentCharge = m_txCurrentModel->CalcTxCharge (it->txPowerDbm, it->duration);
+        }
+      else
+        {
+          segmentCharge = GetStateCurrentA (it->state, it->txPowerDbm) * it->duration.GetSeconds ();
+        }
+      charge += segmentCharge;
+      totalDuration += it->duration.GetSeconds ();
+      m_timelineSeconds[it->state] += it->duration.GetSeconds ();
+      m_timelineEnergy[it->state] += segmentCharge;
+      if (it != timeline.begin () && it->state != (it - 1)->state)
+        {
+          m_stateTransitions[it->state]++;
+        }
+    }
+
+  if (totalDuration > 0)
+    {
+      m_timelineActive = true;
+      m_timelineCurrentA = charge / totalDuration;
+      m_timelineDuration = totalDuration;
+      m_systemcurrent = m_timelineCurrentA;
+    }
+}
+
 void
 SigfoxRadioEnergyModel::HandleEnergyDepletion (void)
 {
@@ -352,17 +469,64 @@ SigfoxRadioEnergyModel::DoDispose (void)
   NS_LOG_FUNCTION (this);
   m_source = NULL;
   m_energyDepletionCallback.Nullify ();
+  m_energyRechargedCallback.Nullify ();
+}
+
+double
+SigfoxRadioEnergyModel::GetTxCharge (Time duration) const
+{
+  if (m_txCurrentModel)
+    {
+      return m_txCurrentModel->CalcTxCharge (m_txPowerDbm, duration);
+    }
+  return m_txCurrentA * duration.GetSeconds ();
+}
+
+void
+SigfoxRadioEnergyModel::AccountElapsed (double seconds, double *stateSeconds,
+                                        double *stateEnergy) const
+{
+  if (m_timelineActive)
+    {
+      // Split the elapsed part of the timeline among its states, in the
+      // same proportion as the whole timeline
+      double fraction = seconds / m_timelineDuration;
+      for (uint32_t i = 0; i < nStates; i++)
+        {
+          stateSeconds[i] += fraction * m_timelineSeconds[i];
+          stateEnergy[i] += fraction * m_timelineEnergy[i];
+        }
+    }
+  else
+    {
+      stateSeconds[m_currentState] += seconds;
+      stateEnergy[m_currentState] += seconds * DoGetCurrentA ();
+    }
 }
 
 double
 SigfoxRadioEnergyModel::DoGetCurrentA (void) const
 {
   NS_LOG_FUNCTION (this);
+  if (m_timelineActive)
+    {
+      return m_timelineCurrentA;
+    }
   switch (m_currentState)
     {
     case EndPointSigfoxPhy::STANDBY:
       return m_idleCurrentA;
     case EndPointSigfoxPhy::TX:
+      if (m_txCurrentModel)
+        {
+          // The average current since the start of the transmission, so
+          // that the source draws the charge of the waveform
+          Time elapsed = Simulator::Now () - m_txStartTime;
+          if (elapsed.IsStrictlyPositive ())
+            {
+              return GetTxCharge (elapsed) / elapsed.GetSeconds ();
+            }
+        }
       return m_txCurrentA;
     case EndPointSigfoxPhy::RX:
       return m_rxCurrentA;
@@ -398,6 +562,29 @@ SigfoxRadioEnergyModel::SetSigfoxRadioState (const EndPointSigfoxPhy::State stat
                 << stateName << " at time = " << Simulator::Now ().GetSeconds () << " s");
 }
 
+double
+SigfoxRadioEnergyModel::GetStateCurrentA (EndPointSigfoxPhy::State state,
+                                          double txPowerDbm) const
+{
+  switch (state)
+    {
+    case EndPointSigfoxPhy::STANDBY:
+      return m_idleCurrentA;
+    case EndPointSigfoxPhy::TX:
+      if (m_txCurrentModel)
+        {
+          return m_txCurrentModel->CalcTxCurrent (txPowerDbm);
+        }
+      return m_txCurrentA;
+    case EndPointSigfoxPhy::RX:
+      return m_rxCurrentA;
+    case EndPointSigfoxPhy::SLEEP:
+      return m_sleepCurrentA;
+    default:
+      NS_FATAL_ERROR ("SigfoxRadioEnergyModel:Undefined radio state:" << state);
+    }
+}
+
 // -------------------------------------------------------------------------- //
 
 SigfoxRadioEnergyModelPhyListener::SigfoxRadioEnergyModelPhyListener ()
@@ -160,6 +160,12 @@ public:
    */
   double GetTotalEnergyConsumption (void) const;
 
+  /**
+   * \returns Total energy consumption, including the part of the current
+   * state that elapsed since the last state change.
+   */
+  double GetTotalEnergyConsumptionUntilNow (void) const;
+
   // Setter & getters for state power consumption.
   /**
    * \brief Gets idle current.
@@ -215,6 +221,26 @@ public:
    */
   EndPointSigfoxPhy::State GetCurrentState (void) const;
 
+  /**
+   * \param state A radio state.
+   * \returns The time spent in that state so far.
+   */
+  Time GetStateTime (EndPointSigfoxPhy::State state) const;
+
+  /**
+   * \param state A radio state.
+   * \returns The energy consumed in that state so far.
+   */
+  double GetStateEnergyConsumption (EndPointSigfoxPhy::State state) const;
+
+  /**
+   * The segments of a PHY timeline are counted when the timeline starts.
+   *
+   * \param state A radio state.
+   * \returns How many times the radio entered that state.
+   */
+  uint64_t GetStateTransitions (EndPointSigfoxPhy::State state) const;
+
   /**
    * \param callback Callback function.
    *
@@ -253,6 +279,30 @@ public:
    */
   void ChangeState (int newState);
 
+  /**
+   * \brief Handle a state change notified directly by an EndPointSigfoxPhy.
+   *
+   * This is equivalent to going through the PHY listener, but it is
+   * non-virtual and inlined in the PHY's state switch functions.
+   *
+   * \param newState New state the sigfox radio is in.
+   * \param txPowerDbm The nominal tx power, only used if newState is TX.
+   */
+  void NotifyPhyStateChange (EndPointSigfoxPhy::State newState, double txPowerDbm);
+
+  /**
+   * \brief Account for a timeline started by an EndPointSigfoxPhy.
+   *
+   * The charge of the whole timeline is computed upfront, and the model
+   * draws the average current of the timeline until the next state change
+   * (that the PHY notifies at the end of the timeline). This way the energy
+   * source is only updated twice per timeline, and still sees the exact
+   * amount of consumed charge.
+   *
+   * \param timeline The segments the radio will go through.
+   */
+  void NotifyPhyTimelineStart (const EndPointSigfoxPhy::Timeline &timeline);
+
   /**
    * \brief Handles energy depletion.
    *
@@ -297,6 +347,33 @@ private:
    */
   void SetSigfoxRadioState (const EndPointSigfoxPhy::State state);
 
+  /**
+   * \param state A radio state.
+   * \param txPowerDbm The nominal tx power, only used if state is TX.
+   * \returns The current drawn by the radio in that state.
+   */
+  double GetStateCurrentA (EndPointSigfoxPhy::State state, double txPowerDbm) const;
+
+  /**
+   * \param duration The time since the start of the transmission.
+   * \returns The charge drawn by the transmission, following the tx current
+   * model if there is one.
+   */
+  double GetTxCharge (Time duration) const;
+
+  /**
+   * Add the time and energy of the current state, or of the current PHY
+   * timeline, to per-state counters.
+   *
+   * \param seconds The time elapsed since the last update.
+   * \param stateSeconds The time counters to update.
+   * \param stateEnergy The energy counters to update.
+   */
+  void AccountElapsed (double seconds, double *stateSeconds, double *stateEnergy) const;
+
+  /// The number of radio states, to size the per-state counters
+  static constexpr uint32_t nStates = EndPointSigfoxPhy::RX + 1;
+
   Ptr<EnergySource> m_source; ///< energy source
 
   // Member variables for current draw in different radio modes.
@@ -306,6 +383,8 @@ private:
   double m_sleepCurrentA; ///< sleep current
   // NOTICE VERY WELL: Current  Model linear or constant as possible choices
   Ptr<SigfoxTxCurrentModel> m_txCurrentModel; ///< current model
+  double m_txPowerDbm; ///< nominal tx power of the current transmission
+  Time m_txStartTime; ///< start of the current transmission
 
   /// This variable keeps track of the total energy consumed by this model.
   TracedValue<double> m_totalEnergyConsumption;
@@ -314,6 +393,17 @@ private:
   EndPointSigfoxPhy::State m_currentState; ///< current state the radio is in
   Time m_lastUpdateTime; ///< time stamp of previous energy update
 
+  bool m_timelineActive; ///< whether we are inside a PHY timeline
+  double m_timelineCurrentA; ///< average current of the current PHY timeline
+  double m_timelineDuration; ///< duration of the current PHY timeline, in seconds
+  double m_timelineSeconds[nStates]; ///< time per state of the current PHY timeline
+  double m_timelineEnergy[nStates]; ///< energy per state of the current PHY timeline
+
+  // Per-state counters, updated at each state change.
+  double m_stateSeconds[nStates]; ///< time spent in each state
+  double m_stateEnergy[nStates]; ///< energy consumed in each state
+  uint64_t m_stateTransitions[nStates]; ///< number of times each state was entered
+
   uint8_t m_nPendingChangeState; ///< pending state change
   bool m_isSupersededChangeState; ///< superseded change state
 
@@ -327,6 +417,18 @@ private:
   SigfoxRadioEnergyModelPhyListener *m_listener;
 };
 
+inline void
+SigfoxRadioEnergyModel::NotifyPhyStateChange (EndPointSigfoxPhy::State newState,
+                                              double txPowerDbm)
+{
+  if (newState == EndPointSigfoxPhy::TX)
+    {
+      SetTxCurrentFromModel (txPowerDbm);
+    }
+  // Qualified call, so that the compiler can skip the vtable lookup
+  SigfoxRadioEnergyModel::ChangeState (newState);
+}
+
 } // namespace sigfox
 
 } // namespace ns3
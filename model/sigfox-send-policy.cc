@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/sigfox-send-policy.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/log.h"
+#include <cmath>
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("SigfoxSendPolicy");
+
+NS_OBJECT_ENSURE_REGISTERED (SigfoxSendPolicy);
+
+TypeId
+SigfoxSendPolicy::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SigfoxSendPolicy")
+    .SetParent<Object> ()
+    .SetGroupName ("sigfox")
+  ;
+  return tid;
+}
+
+SigfoxSendPolicy::SigfoxSendPolicy ()
+{
+}
+
+SigfoxSendPolicy::~SigfoxSendPolicy ()
+{
+}
+
+NS_OBJECT_ENSURE_REGISTERED (DeltaSigfoxSendPolicy);
+
+TypeId
+DeltaSigfoxSendPolicy::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DeltaSigfoxSendPolicy")
+    .SetParent<SigfoxSendPolicy> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<DeltaSigfoxSendPolicy> ()
+    .AddAttribute ("Threshold",
+                   "The change from the previous measurement that triggers a message",
+                   DoubleValue (30),
+                   MakeDoubleAccessor (&DeltaSigfoxSendPolicy::m_threshold),
+                   MakeDoubleChecker<double> (0))
+  ;
+  return tid;
+}
+
+DeltaSigfoxSendPolicy::DeltaSigfoxSendPolicy ()
+  : m_threshold (30),
+    m_previous (0),
+    m_first (true)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DeltaSigfoxSendPolicy::~DeltaSigfoxSendPolicy ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+bool
+DeltaSigfoxSendPolicy::ShouldSend (double value)
+{
+  NS_LOG_FUNCTION (this << value);
+
+  // The first measurement tells the network where we start from
+  bool send = m_first || std::fabs (value - m_previous) > m_threshold;
+  m_previous = value;
+  m_first = false;
+  return send;
+}
+
+NS_OBJECT_ENSURE_REGISTERED (DeadBandSigfoxSendPolicy);
+
+TypeId
+DeadBandSigfoxSendPolicy::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DeadBandSigfoxSendPolicy")
+    .SetParent<SigfoxSendPolicy> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<DeadBandSigfoxSendPolicy> ()
+    .AddAttribute ("Width",
+                   "The distance from the last measurement sent that triggers a message",
+                   DoubleValue (30),
+                   MakeDoubleAccessor (&DeadBandSigfoxSendPolicy::m_width),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("MaxSilence",
+                   "The number of measurements after which a message is sent "
+                   "even if the value stayed in the band, 0 to disable",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&DeadBandSigfoxSendPolicy::m_maxSilence),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+DeadBandSigfoxSendPolicy::DeadBandSigfoxSendPolicy ()
+  : m_width (30),
+    m_maxSilence (0),
+    m_lastSent (0),
+    m_silence (0),
+    m_first (true)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DeadBandSigfoxSendPolicy::~DeadBandSigfoxSendPolicy ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+bool
+DeadBandSigfoxSendPolicy::ShouldSend (double value)
+{
+  NS_LOG_FUNCTION (this << value);
+
+  m_silence++;
+  if (m_first || std::fabs (value - m_lastSent) > m_width ||
+      (m_maxSilence > 0 && m_silence >= m_maxSilence))
+    {
+      m_lastSent = value;
+      m_silence = 0;
+      m_first = false;
+      return true;
+    }
+  return false;
+}
+
+} // namespace sigfox
+} // namespace ns3
@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef SIGFOX_SEND_POLICY_H
+#define SIGFOX_SEND_POLICY_H
+
+#include "ns3/object.h"
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * Decide which measurements of a sensor are worth a message.
+ *
+ * A policy is fed every measurement of a single device, in order, and keeps
+ * whatever state it needs between them: each application needs its own
+ * instance.
+ */
+class SigfoxSendPolicy : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  SigfoxSendPolicy ();
+  virtual ~SigfoxSendPolicy ();
+
+  /**
+   * Feed a new measurement to the policy.
+   *
+   * \param value The measurement.
+   * \return Whether the measurement should be sent.
+   */
+  virtual bool ShouldSend (double value) = 0;
+};
+
+/**
+ * Send a measurement when it differs from the previous measurement by more
+ * than a threshold, i.e., when the measured quantity changes quickly.
+ */
+class DeltaSigfoxSendPolicy : public SigfoxSendPolicy
+{
+public:
+  static TypeId GetTypeId (void);
+
+  DeltaSigfoxSendPolicy ();
+  virtual ~DeltaSigfoxSendPolicy ();
+
+  bool ShouldSend (double value);
+
+private:
+  double m_threshold; //!< The change that triggers a message
+  double m_previous;  //!< The previous measurement
+  bool m_first;       //!< Whether no measurement was fed yet
+};
+
+/**
+ * Send a measurement when it leaves a band around the last measurement that
+ * was sent, so that the network always knows the measured quantity within
+ * the width of the band. This is the policy of the Data Compression
+ * Strategy of PeriodicSender.
+ */
+class DeadBandSigfoxSendPolicy : public SigfoxSendPolicy
+{
+public:
+  static TypeId GetTypeId (void);
+
+  DeadBandSigfoxSendPolicy ();
+  virtual ~DeadBandSigfoxSendPolicy ();
+
+  bool ShouldSend (double value);
+
+private:
+  double m_width;        //!< The distance from the last sent value that triggers a message
+  uint32_t m_maxSilence; //!< Measurements after which a message is sent anyway, 0 for never
+  double m_lastSent;     //!< The last measurement that was sent
+  uint32_t m_silence;    //!< Measurements since the last message
+  bool m_first;          //!< Whether no measurement was fed yet
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* SIGFOX_SEND_POLICY_H */
@@ -21,6 +21,8 @@
 #include "ns3/sigfox-tag.h"
 #include "ns3/tag.h"
 #include "ns3/uinteger.h"
+#include <algorithm>
+#include <cmath>
 
 namespace ns3 {
 namespace sigfox {
@@ -50,7 +52,10 @@ SigfoxTag::SigfoxTag () :
   m_durationSeconds (0),
   m_repNumber (0),
   m_packetNumber (0),
-  m_senderId (0)
+  m_senderId (0),
+  m_downlinkRequested (0),
+  m_linkMargin (0),
+  m_gatewayCount (0)
 {
 }
 
@@ -75,6 +80,9 @@ SigfoxTag::Serialize (TagBuffer i) const
   i.WriteU8(m_repNumber);
   i.WriteU8(m_packetNumber);
   i.WriteU32(m_senderId);
+  i.WriteU8 (m_downlinkRequested);
+  i.WriteU8 (static_cast<uint8_t> (m_linkMargin));
+  i.WriteU8 (m_gatewayCount);
 }
 
 void
@@ -86,6 +94,9 @@ SigfoxTag::Deserialize (TagBuffer i)
   m_repNumber = i.ReadU8();
   m_packetNumber = i.ReadU8();
   m_senderId = i.ReadU32();
+  m_downlinkRequested = i.ReadU8 ();
+  m_linkMargin = static_cast<int8_t> (i.ReadU8 ());
+  m_gatewayCount = i.ReadU8 ();
 }
 
 void
@@ -167,5 +178,42 @@ SigfoxTag::SetDurationSeconds (double durationSeconds)
   m_durationSeconds = durationSeconds;
 }
 
+void
+SigfoxTag::SetDownlinkRequested (bool requested)
+{
+  m_downlinkRequested = requested;
+}
+
+bool
+SigfoxTag::IsDownlinkRequested (void)
+{
+  return m_downlinkRequested;
+}
+
+void
+SigfoxTag::SetLinkMargin (double marginDb)
+{
+  // Carried with a 1 dB resolution, like the margins reported by the network
+  m_linkMargin = static_cast<int8_t> (std::max (-128.0, std::min (127.0, std::floor (marginDb))));
+}
+
+double
+SigfoxTag::GetLinkMargin (void)
+{
+  return m_linkMargin;
+}
+
+void
+SigfoxTag::SetGatewayCount (uint8_t gatewayCount)
+{
+  m_gatewayCount = gatewayCount;
+}
+
+uint8_t
+SigfoxTag::GetGatewayCount (void)
+{
+  return m_gatewayCount;
+}
+
 }
 } // namespace ns3
@@ -105,6 +105,45 @@ public:
 
   double GetDurationSeconds (void);
 
+  /**
+   * Set whether the sender of this uplink packet expects a downlink reply.
+   *
+   * \param requested Whether a downlink is requested.
+   */
+  void SetDownlinkRequested (bool requested);
+
+  /**
+   * Get whether the sender of this uplink packet expects a downlink reply.
+   */
+  bool IsDownlinkRequested (void);
+
+  /**
+   * Set the link margin reported by the network to the end point, carried by
+   * downlink packets.
+   *
+   * \param marginDb The margin of the best gateway over its sensitivity, in dB.
+   */
+  void SetLinkMargin (double marginDb);
+
+  /**
+   * Get the link margin reported by the network to the end point.
+   */
+  double GetLinkMargin (void);
+
+  /**
+   * Set the number of gateways that received the uplink this downlink
+   * packet answers to.
+   *
+   * \param gatewayCount The number of gateways.
+   */
+  void SetGatewayCount (uint8_t gatewayCount);
+
+  /**
+   * Get the number of gateways that received the uplink this downlink packet
+   * answers to, or 0 if this packet carries no link information.
+   */
+  uint8_t GetGatewayCount (void);
+
 private:
   double m_receivePower; //!< The reception power of this packet.
   double m_frequency; //!< The frequency of this packet
@@ -112,6 +151,9 @@ private:
   uint8_t m_repNumber;
   uint8_t m_packetNumber;
   uint32_t m_senderId;
+  uint8_t m_downlinkRequested; //!< Whether the sender expects a downlink
+  int8_t m_linkMargin; //!< The reported link margin, in dB
+  uint8_t m_gatewayCount; //!< The reported number of gateways
 };
 } // namespace ns3
 }
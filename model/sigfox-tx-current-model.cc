@@ -19,7 +19,12 @@
 #include "sigfox-tx-current-model.h"
 #include "ns3/log.h"
 #include "ns3/double.h"
+#include "ns3/string.h"
+#include "ns3/abort.h"
 #include "sigfox-utils.h"
+#include <cmath>
+#include <fstream>
+#include <sstream>
 
 namespace ns3 {
 namespace sigfox {
@@ -46,6 +51,12 @@ SigfoxTxCurrentModel::~SigfoxTxCurrentModel ()
 {
 }
 
+double
+SigfoxTxCurrentModel::CalcTxCharge (double txPowerDbm, Time duration) const
+{
+  return CalcTxCurrent (txPowerDbm) * duration.GetSeconds ();
+}
+
 // Similarly to the wifi case
 NS_OBJECT_ENSURE_REGISTERED (LinearSigfoxTxCurrentModel);
 
@@ -76,6 +87,9 @@ LinearSigfoxTxCurrentModel::GetTypeId (void)
 }
 
 LinearSigfoxTxCurrentModel::LinearSigfoxTxCurrentModel ()
+  : m_fileLoaded (true),
+    m_cachedTxPowerDbm (NAN),
+    m_cachedTxCurrent (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -90,6 +104,7 @@ LinearSigfoxTxCurrentModel::SetEta (double eta)
 {
   NS_LOG_FUNCTION (this << eta);
   m_eta = eta;
+  m_cachedTxPowerDbm = NAN;
 }
 
 void
@@ -97,6 +112,7 @@ LinearSigfoxTxCurrentModel::SetVoltage (double voltage)
 {
   NS_LOG_FUNCTION (this << voltage);
   m_voltage = voltage;
+  m_cachedTxPowerDbm = NAN;
 }
 
 void
@@ -104,6 +120,7 @@ LinearSigfoxTxCurrentModel::SetStandbyCurrent (double idleCurrent)
 {
   NS_LOG_FUNCTION (this << idleCurrent);
   m_idleCurrent = idleCurrent;
+  m_cachedTxPowerDbm = NAN;
 }
 
 double
@@ -128,7 +145,12 @@ double
 LinearSigfoxTxCurrentModel::CalcTxCurrent (double txPowerDbm) const
 {
   NS_LOG_FUNCTION (this << txPowerDbm);
-  return DbmToW (txPowerDbm) / (m_voltage * m_eta) + m_idleCurrent;
+  if (txPowerDbm != m_cachedTxPowerDbm)
+    {
+      m_cachedTxPowerDbm = txPowerDbm;
+      m_cachedTxCurrent = DbmToW (txPowerDbm) / (m_voltage * m_eta) + m_idleCurrent;
+    }
+  return m_cachedTxCurrent;
 }
 
 
@@ -181,5 +203,212 @@ ConstantSigfoxTxCurrentModel::CalcTxCurrent (double txPowerDbm) const
   return m_txCurrent;
 }
 
+NS_OBJECT_ENSURE_REGISTERED (WaveformSigfoxTxCurrentModel);
+
+TypeId
+WaveformSigfoxTxCurrentModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::WaveformSigfoxTxCurrentModel")
+    .SetParent<SigfoxTxCurrentModel> ()
+    .SetGroupName ("Sigfox")
+    .AddConstructor<WaveformSigfoxTxCurrentModel> ()
+    .AddAttribute ("Resolution",
+                   "The step of the cumulative charge tables, that must be set "
+                   "before the waveforms are loaded.",
+                   TimeValue (MicroSeconds (100)),
+                   MakeTimeAccessor (&WaveformSigfoxTxCurrentModel::m_resolution),
+                   MakeTimeChecker (NanoSeconds (1)))
+    .AddAttribute ("WaveformFile",
+                   "The file with the current waveforms, or empty to add them "
+                   "with AddWaveform.",
+                   StringValue ("src/sigfox/data/sigfox-tx-waveform.txt"),
+                   MakeStringAccessor (&WaveformSigfoxTxCurrentModel::SetWaveformFile,
+                                       &WaveformSigfoxTxCurrentModel::GetWaveformFile),
+                   MakeStringChecker ())
+  ;
+  return tid;
+}
+
+WaveformSigfoxTxCurrentModel::WaveformSigfoxTxCurrentModel ()
+  : m_cachedTxPowerDbm (NAN),
+    m_cachedWaveform (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+WaveformSigfoxTxCurrentModel::~WaveformSigfoxTxCurrentModel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+WaveformSigfoxTxCurrentModel::SetWaveformFile (std::string filename)
+{
+  NS_LOG_FUNCTION (this << filename);
+
+  m_waveformFile = filename;
+  m_waveforms.clear ();
+  m_cachedWaveform = 0;
+  m_fileLoaded = filename.empty ();
+}
+
+std::string
+WaveformSigfoxTxCurrentModel::GetWaveformFile (void) const
+{
+  return m_waveformFile;
+}
+
+void
+WaveformSigfoxTxCurrentModel::LoadWaveformFile (void) const
+{
+  if (m_fileLoaded)
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this << m_waveformFile);
+  m_fileLoaded = true;
+
+  std::ifstream in (m_waveformFile.c_str ());
+  if (!in.is_open ())
+    {
+      NS_FATAL_ERROR ("Cannot open " << m_waveformFile);
+    }
+
+  // Group the samples by power, keeping the order of the file
+  std::map<double, std::pair<std::vector<Time>, std::vector<double> > > samples;
+  std::string line;
+  while (std::getline (in, line))
+    {
+      if (line.empty () || line[0] == '#')
+        {
+          continue;
+        }
+      std::istringstream fields (line);
+      double txPowerDbm, timeS, currentA;
+      if (!(fields >> txPowerDbm >> timeS >> currentA))
+        {
+          NS_FATAL_ERROR ("Malformed line in " << m_waveformFile << ": " << line);
+        }
+      samples[txPowerDbm].first.push_back (Seconds (timeS));
+      samples[txPowerDbm].second.push_back (currentA);
+    }
+
+  for (std::map<double, std::pair<std::vector<Time>, std::vector<double> > >::const_iterator it =
+           samples.begin ();
+       it != samples.end (); it++)
+    {
+      m_waveforms[it->first] = IntegrateWaveform (it->second.first, it->second.second);
+    }
+  m_cachedWaveform = 0;
+}
+
+void
+WaveformSigfoxTxCurrentModel::AddWaveform (double txPowerDbm, const std::vector<Time> &times,
+                                           const std::vector<double> &currents)
+{
+  NS_LOG_FUNCTION (this << txPowerDbm << times.size ());
+
+  // Load the file first, so that this waveform is not replaced by its own
+  LoadWaveformFile ();
+  m_waveforms[txPowerDbm] = IntegrateWaveform (times, currents);
+  m_cachedWaveform = 0;
+}
+
+WaveformSigfoxTxCurrentModel::Waveform
+WaveformSigfoxTxCurrentModel::IntegrateWaveform (const std::vector<Time> &times,
+                                                 const std::vector<double> &currents) const
+{
+  NS_ABORT_MSG_IF (times.empty () || times.size () != currents.size (),
+                   "A waveform needs as many times as currents");
+  NS_ABORT_MSG_IF (!times.front ().IsZero (), "A waveform must start at zero");
+  for (uint32_t i = 1; i < times.size (); i++)
+    {
+      NS_ABORT_MSG_IF (times[i] < times[i - 1], "Waveform times must increase");
+    }
+
+  // Integrate the piecewise constant current exactly at each grid point
+  Waveform waveform;
+  waveform.plateauCurrentA = currents.back ();
+  waveform.charge.push_back (0);
+
+  double charge = 0;
+  Time t = Seconds (0);
+  uint32_t sample = 0;
+  while (t < times.back ())
+    {
+      Time next = t + m_resolution;
+      // Add the samples that start before the next grid point
+      while (sample + 1 < times.size () && times[sample + 1] <= next)
+        {
+          charge += currents[sample] * (times[sample + 1] - std::max (t, times[sample])).GetSeconds ();
+          t = std::max (t, times[sample + 1]);
+          sample++;
+        }
+      charge += currents[sample] * (next - t).GetSeconds ();
+      t = next;
+      waveform.charge.push_back (charge);
+    }
+
+  return waveform;
+}
+
+const WaveformSigfoxTxCurrentModel::Waveform &
+WaveformSigfoxTxCurrentModel::GetWaveform (double txPowerDbm) const
+{
+  if (m_cachedWaveform != 0 && txPowerDbm == m_cachedTxPowerDbm)
+    {
+      return *m_cachedWaveform;
+    }
+
+  LoadWaveformFile ();
+  NS_ABORT_MSG_IF (m_waveforms.empty (), "No tx current waveform was loaded");
+
+  std::map<double, Waveform>::const_iterator above = m_waveforms.lower_bound (txPowerDbm);
+  std::map<double, Waveform>::const_iterator closest = above;
+  if (above == m_waveforms.end ())
+    {
+      closest = --above;
+    }
+  else if (above != m_waveforms.begin ())
+    {
+      std::map<double, Waveform>::const_iterator below = above;
+      below--;
+      if (txPowerDbm - below->first < above->first - txPowerDbm)
+        {
+          closest = below;
+        }
+    }
+
+  m_cachedTxPowerDbm = txPowerDbm;
+  m_cachedWaveform = &closest->second;
+  return closest->second;
+}
+
+double
+WaveformSigfoxTxCurrentModel::CalcTxCurrent (double txPowerDbm) const
+{
+  NS_LOG_FUNCTION (this << txPowerDbm);
+  return GetWaveform (txPowerDbm).plateauCurrentA;
+}
+
+double
+WaveformSigfoxTxCurrentModel::CalcTxCharge (double txPowerDbm, Time duration) const
+{
+  const Waveform &waveform = GetWaveform (txPowerDbm);
+  const std::vector<double> &charge = waveform.charge;
+
+  int64_t step = m_resolution.GetTimeStep ();
+  int64_t k = duration.GetTimeStep () / step;
+  double fraction = double (duration.GetTimeStep () - k * step) / step;
+
+  if (k + 1 >= static_cast<int64_t> (charge.size ()))
+    {
+      // Past the end of the waveform, on the plateau
+      Time end = TimeStep (step * static_cast<int64_t> (charge.size () - 1));
+      return charge.back () + waveform.plateauCurrentA * (duration - end).GetSeconds ();
+    }
+  return charge[k] + (charge[k + 1] - charge[k]) * fraction;
+}
+
 }
 } // namespace ns3
@@ -20,6 +20,10 @@
 #define SIGFOX_TX_CURRENT_MODEL_H
 
 #include "ns3/object.h"
+#include "ns3/nstime.h"
+#include <map>
+#include <string>
+#include <vector>
 
 namespace ns3 {
 namespace sigfox {
@@ -45,6 +49,18 @@ public:
    * \returns The transmit current (in Ampere)
    */
   virtual double CalcTxCurrent (double txPowerDbm) const = 0;
+
+  /**
+   * Get the charge drawn by a transmission at this power.
+   *
+   * The default implementation assumes the current is constant during the
+   * transmission.
+   *
+   * \param txPowerDbm The nominal tx power in dBm
+   * \param duration The time elapsed since the start of the transmission
+   * \returns The charge drawn since the start of the transmission
+   */
+  virtual double CalcTxCharge (double txPowerDbm, Time duration) const;
 };
 
 /**
@@ -101,6 +117,10 @@ private:
   double m_eta;     //!< ETA
   double m_voltage;     //!< Voltage
   double m_idleCurrent;     //!< Standby current
+
+  // Devices transmit at the same power over and over
+  mutable double m_cachedTxPowerDbm; //!< The power of the last computation
+  mutable double m_cachedTxCurrent;  //!< The current of the last computation
 };
 
 class ConstantSigfoxTxCurrentModel : public SigfoxTxCurrentModel
@@ -134,6 +154,105 @@ private:
   double m_txCurrent;
 };
 
+/**
+ * A model of the transmission current based on measured current waveforms.
+ *
+ * Real modules do not draw a constant current while transmitting: the
+ * oscillators start up, and the power amplifier ramps up before reaching
+ * its plateau. This model reads, for each nominal tx power, the current
+ * drawn as a function of the time since the start of the transmission, and
+ * precomputes the cumulative charge on a grid of Resolution. The charge of
+ * a transmission of any duration is then interpolated in constant time.
+ *
+ * The waveform file is text, one sample per line:
+ *
+ *   txPowerDbm timeS currentA
+ *
+ * where the current holds until the next sample of the same power, and the
+ * last current of each power holds for longer transmissions. Lines starting
+ * with # are ignored. Transmissions at a power without a waveform use the
+ * closest one. The file is only read when a waveform is first needed, so
+ * attributes can be set in any order.
+ */
+class WaveformSigfoxTxCurrentModel : public SigfoxTxCurrentModel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  WaveformSigfoxTxCurrentModel ();
+  virtual ~WaveformSigfoxTxCurrentModel ();
+
+  /**
+   * Load the waveforms of a file, replacing the current ones. The file is
+   * read when a waveform is first needed.
+   *
+   * \param filename The waveform file.
+   */
+  void SetWaveformFile (std::string filename);
+
+  /**
+   * \return The file the waveforms were loaded from.
+   */
+  std::string GetWaveformFile (void) const;
+
+  /**
+   * Add the waveform of a nominal tx power, replacing the one of the
+   * waveform file if any.
+   *
+   * \param txPowerDbm The nominal tx power in dBm
+   * \param times The start of each sample, increasing from zero.
+   * \param currents The current drawn from each start to the next.
+   */
+  void AddWaveform (double txPowerDbm, const std::vector<Time> &times,
+                    const std::vector<double> &currents);
+
+  /**
+   * \return The current of the plateau the transmission settles to.
+   */
+  double CalcTxCurrent (double txPowerDbm) const;
+
+  double CalcTxCharge (double txPowerDbm, Time duration) const;
+
+private:
+  /**
+   * The cumulative charge of the waveform of a tx power.
+   */
+  struct Waveform
+  {
+    std::vector<double> charge; //!< The charge at each multiple of the resolution
+    double plateauCurrentA;     //!< The current after the last sample
+  };
+
+  /**
+   * Read the waveform file, if it was not read yet.
+   */
+  void LoadWaveformFile (void) const;
+
+  /**
+   * Integrate the samples of a waveform.
+   *
+   * \param times The start of each sample, increasing from zero.
+   * \param currents The current drawn from each start to the next.
+   * \return The waveform.
+   */
+  Waveform IntegrateWaveform (const std::vector<Time> &times,
+                              const std::vector<double> &currents) const;
+
+  /**
+   * \param txPowerDbm A nominal tx power.
+   * \return The waveform of the closest tx power.
+   */
+  const Waveform &GetWaveform (double txPowerDbm) const;
+
+  std::string m_waveformFile;  //!< The file the waveforms are loaded from
+  Time m_resolution;           //!< The step of the cumulative charge tables
+  mutable bool m_fileLoaded;   //!< Whether m_waveformFile was read
+  mutable std::map<double, Waveform> m_waveforms; //!< The waveforms, by tx power
+
+  mutable double m_cachedTxPowerDbm;           //!< The power of the last lookup
+  mutable const Waveform *m_cachedWaveform;    //!< The waveform of the last lookup
+};
+
 } // namespace ns3
 
 }
@@ -60,6 +60,16 @@ SimpleEndPointSigfoxPhy::Send (Ptr<Packet> packet, SigfoxTxParameters txParams,
 
   NS_LOG_INFO ("Current state: " << m_state);
 
+  // If a timeline is running, it already describes the state of the radio:
+  // we only need to put the packet on the channel.
+  if (IsTimelineRunning ())
+    {
+      NS_ASSERT (GetState () == TX);
+      Time duration = GetOnAirTime (packet, txParams);
+      DoSend (packet, txParams, frequencyHz, txPowerDbm, duration);
+      return;
+    }
+
   // We must be either in STANDBY or SLEEP mode to send a packet
   if (m_state != STANDBY && m_state != SLEEP)
     {
@@ -73,16 +83,7 @@ SimpleEndPointSigfoxPhy::Send (Ptr<Packet> packet, SigfoxTxParameters txParams,
   // We can send the packet: switch to the TX state
   SwitchToTx (txPowerDbm);
 
-  // Tag the packet
-  SigfoxTag tag;
-  packet->RemovePacketTag (tag);
-  tag.SetFrequency (frequencyHz);
-  tag.SetDurationSeconds (duration.GetSeconds ());
-  packet->AddPacketTag (tag);
-
-  // Send the packet over the channel
-  NS_LOG_INFO ("Sending the packet in the channel");
-  m_channel->Send (this, packet, txPowerDbm, txParams, duration, frequencyHz);
+  DoSend (packet, txParams, frequencyHz, txPowerDbm, duration);
 
   // Schedule the switch back to STANDBY mode.
   // For reference see SX1272 datasheet, section 4.1.6
@@ -98,7 +99,93 @@ SimpleEndPointSigfoxPhy::Send (Ptr<Packet> packet, SigfoxTxParameters txParams,
                            &SimpleEndPointSigfoxPhy::m_txFinishedCallback, this,
                            packet);
     }
+}
+
+void
+SimpleEndPointSigfoxPhy::SendBurst (Ptr<Packet> packet, SigfoxTxParameters txParams,
+                                    const SigfoxBurstParameters &burst, double txPowerDbm)
+{
+  NS_LOG_FUNCTION (this << packet << txParams << burst.startOffsets.size () << txPowerDbm);
+
+  NS_ASSERT (!burst.startOffsets.empty ());
+  NS_ASSERT (burst.startOffsets.size () == burst.frequenciesHz.size ());
+  NS_ASSERT (burst.startOffsets.front ().IsZero ());
+
+  Time duration = GetOnAirTime (packet, txParams);
+
+  // Unless a timeline already describes what the radio does, go through TX
+  // and STANDBY for each repetition
+  if (!IsTimelineRunning ())
+    {
+      if (m_state != STANDBY && m_state != SLEEP)
+        {
+          NS_LOG_INFO ("Cannot send because device is currently not in STANDBY or SLEEP mode");
+          return;
+        }
+
+      SwitchToTx (txPowerDbm);
+      Simulator::Schedule (duration, &EndPointSigfoxPhy::SwitchToStandby, this);
+      for (std::size_t rep = 1; rep < burst.startOffsets.size (); rep++)
+        {
+          Simulator::Schedule (burst.startOffsets[rep], &SimpleEndPointSigfoxPhy::SwitchToTx,
+                               this, txPowerDbm);
+          Simulator::Schedule (burst.startOffsets[rep] + duration,
+                               &EndPointSigfoxPhy::SwitchToStandby, this);
+        }
+
+      // Same as in Send, but after the last repetition
+      if (!m_txFinishedCallback.IsNull ())
+        {
+          Simulator::Schedule (burst.startOffsets.back () + duration + NanoSeconds (10),
+                               &SimpleEndPointSigfoxPhy::m_txFinishedCallback, this,
+                               packet);
+        }
+    }
 
+  // Tag the packet with the parameters of the first repetition, the channel
+  // updates them for the following ones
+  SigfoxTag tag;
+  packet->PeekPacketTag (tag);
+  tag.SetFrequency (burst.frequenciesHz.front ());
+  tag.SetDurationSeconds (duration.GetSeconds ());
+  if (!packet->ReplacePacketTag (tag))
+    {
+      packet->AddPacketTag (tag);
+    }
+
+  NS_LOG_INFO ("Sending a burst of " << burst.startOffsets.size () << " repetitions in the channel");
+  m_channel->SendBurst (this, packet, txPowerDbm, txParams, duration, burst);
+
+  // Call the trace source, once for the whole burst
+  if (m_device)
+    {
+      m_startSending (packet, m_device->GetNode ()->GetId ());
+    }
+  else
+    {
+      m_startSending (packet, 0);
+    }
+}
+
+void
+SimpleEndPointSigfoxPhy::DoSend (Ptr<Packet> packet, SigfoxTxParameters txParams,
+                                 double frequencyHz, double txPowerDbm, Time duration)
+{
+  NS_LOG_FUNCTION (this << packet << frequencyHz << txPowerDbm << duration);
+
+  // Tag the packet
+  SigfoxTag tag;
+  packet->PeekPacketTag (tag);
+  tag.SetFrequency (frequencyHz);
+  tag.SetDurationSeconds (duration.GetSeconds ());
+  if (!packet->ReplacePacketTag (tag))
+    {
+      packet->AddPacketTag (tag);
+    }
+
+  // Send the packet over the channel
+  NS_LOG_INFO ("Sending the packet in the channel");
+  m_channel->Send (this, packet, txPowerDbm, txParams, duration, frequencyHz);
 
   // Call the trace source
   if (m_device)
@@ -113,11 +200,11 @@ SimpleEndPointSigfoxPhy::Send (Ptr<Packet> packet, SigfoxTxParameters txParams,
 
 void
 SimpleEndPointSigfoxPhy::StartReceive (Ptr<Packet> packet, double rxPowerDbm,
-                                       Time duration, double frequencyMHz)
+                                       Time duration, double frequencyHz)
 {
 
   NS_LOG_FUNCTION (this << packet << rxPowerDbm << duration <<
-                   frequencyMHz);
+                   frequencyHz);
 
   // Notify the SigfoxInterferenceHelper of the impinging signal, and remember
   // the event it creates. This will be used then to correctly handle the end
@@ -128,10 +215,10 @@ SimpleEndPointSigfoxPhy::StartReceive (Ptr<Packet> packet, double rxPowerDbm,
   // still incoming.
 
   Ptr<SigfoxInterferenceHelper::Event> event;
-  event = m_interference.Add (duration, rxPowerDbm, packet, frequencyMHz);
+  event = m_interference.Add (duration, rxPowerDbm, packet, frequencyHz);
 
   // Switch on the current PHY state
-  switch (m_state)
+  switch (GetState ())
     {
     // In the SLEEP, TX and RX cases we cannot receive the packet: we only add
     // it to the list of interferers and do not schedule an EndReceive event for
@@ -169,11 +256,11 @@ SimpleEndPointSigfoxPhy::StartReceive (Ptr<Packet> packet, double rxPowerDbm,
 
         // Check frequency
         //////////////////
-        if (!IsOnFrequency (frequencyMHz))
+        if (!IsOnFrequency (frequencyHz))
           {
             NS_LOG_INFO ("Packet lost because it's on frequency " <<
-                         frequencyMHz << " MHz and we are listening at " <<
-                         m_frequency << " MHz");
+                         frequencyHz << " Hz and we are listening at " <<
+                         m_frequency << " Hz");
 
             // Fire the trace source for this event.
             if (m_device)
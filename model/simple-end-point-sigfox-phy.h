@@ -50,7 +50,7 @@ public:
 
   // Implementation of EndPointSigfoxPhy's pure virtual functions
   virtual void StartReceive (Ptr<Packet> packet, double rxPowerDbm,
-                             Time duration, double frequencyMHz);
+                             Time duration, double frequencyHz);
 
   // Implementation of SigfoxPhy's pure virtual functions
   virtual void EndReceive (Ptr<Packet> packet,
@@ -60,7 +60,23 @@ public:
   virtual void Send (Ptr<Packet> packet, SigfoxTxParameters txParams,
                      double frequencyHz, double txPowerDbm);
 
+  // Implementation of EndPointSigfoxPhy's pure virtual functions
+  virtual void SendBurst (Ptr<Packet> packet, SigfoxTxParameters txParams,
+                          const SigfoxBurstParameters &burst, double txPowerDbm);
+
 private:
+  /**
+   * Tag the packet and put it on the channel, without touching the state of
+   * the radio.
+   *
+   * \param packet The packet to send.
+   * \param txParams The parameters of the transmission.
+   * \param frequencyHz The carrier frequency.
+   * \param txPowerDbm The nominal tx power.
+   * \param duration The on-air time of the packet.
+   */
+  void DoSend (Ptr<Packet> packet, SigfoxTxParameters txParams,
+               double frequencyHz, double txPowerDbm, Time duration);
 };
 
 } /* namespace ns3 */
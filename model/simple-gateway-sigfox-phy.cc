@@ -83,6 +83,8 @@ SimpleGatewaySigfoxPhy::Send (Ptr<Packet> packet, SigfoxTxParameters txParams,
   Simulator::Schedule (duration, &SimpleGatewaySigfoxPhy::TxFinished, this, packet);
 
   m_isTransmitting = true;
+  m_transmissionTime += duration;
+  m_transmissionEnd = Simulator::Now () + duration;
 
   // Fire the trace source
   if (m_device)
@@ -170,6 +172,9 @@ SimpleGatewaySigfoxPhy::EndReceive (Ptr<Packet> packet,
   // Call the trace source
   m_phyRxEndTrace (packet);
 
+  // The demodulator was busy whatever the outcome
+  m_receptionTime += event->GetDuration ();
+
   // Call the SigfoxInterferenceHelper to determine whether there was
   // destructive interference. If the packet is correctly received, this
   // method returns a 0.
@@ -198,6 +203,7 @@ SimpleGatewaySigfoxPhy::EndReceive (Ptr<Packet> packet,
   else       // Reception was correct
     {
       NS_LOG_INFO ("Packet received correctly");
+      m_receptionCount++;
 
       // Fire the trace source
       if (m_device)
@@ -219,10 +225,13 @@ SimpleGatewaySigfoxPhy::EndReceive (Ptr<Packet> packet,
           // information can be useful for upper layers trying to control link
           // quality.
           SigfoxTag tag;
-          packet->RemovePacketTag (tag);
+          packet->PeekPacketTag (tag);
           tag.SetReceivePower (event->GetRxPowerdBm ());
           tag.SetFrequency (event->GetFrequency ());
-          packet->AddPacketTag (tag);
+          if (!packet->ReplacePacketTag (tag))
+            {
+              packet->AddPacketTag (tag);
+            }
 
           m_rxOkCallback (packet);
         }
@@ -46,13 +46,13 @@ public:
   SimpleGatewaySigfoxPhy ();
   virtual ~SimpleGatewaySigfoxPhy ();
 
-  virtual void StartReceive (Ptr<Packet> packet, double rxPowerDbm, Time duration, double frequencyMHz);
+  virtual void StartReceive (Ptr<Packet> packet, double rxPowerDbm, Time duration, double frequencyHz);
 
   virtual void EndReceive (Ptr<Packet> packet,
                            Ptr<SigfoxInterferenceHelper::Event> event);
 
   virtual void Send (Ptr<Packet> packet, SigfoxTxParameters txParams,
-                     double frequencyMHz, double txPowerDbm);
+                     double frequencyHz, double txPowerDbm);
 
 private:
 };
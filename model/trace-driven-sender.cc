@@ -0,0 +1,217 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/trace-driven-sender.h"
+#include "ns3/sigfox-net-device.h"
+#include "ns3/sigfox-radio-configuration.h"
+#include "ns3/simulator.h"
+#include "ns3/pointer.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("TraceDrivenSender");
+
+NS_OBJECT_ENSURE_REGISTERED (TraceDrivenSender);
+
+TypeId
+TraceDrivenSender::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::TraceDrivenSender")
+    .SetParent<Application> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<TraceDrivenSender> ()
+    .AddAttribute ("TraceFile",
+                   "The columnar trace file to replay",
+                   StringValue (""),
+                   MakeStringAccessor (&TraceDrivenSender::m_traceFile),
+                   MakeStringChecker ())
+    .AddAttribute ("Column",
+                   "The column of the trace replayed by this application",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TraceDrivenSender::m_column),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("StartRow",
+                   "The measurement replayed when the application starts",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TraceDrivenSender::m_startRow),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("ChunkRows",
+                   "The number of measurements after which the memory used by "
+                   "the measurements that were read is released",
+                   UintegerValue (4096),
+                   MakeUintegerAccessor (&TraceDrivenSender::m_chunkRows),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("PacketSize",
+                   "The payload size of messages, in bytes",
+                   UintegerValue (10),
+                   MakeUintegerAccessor (&TraceDrivenSender::m_pktSize),
+                   MakeUintegerChecker<uint8_t> (0, maxUplinkPayloadSize))
+    .AddAttribute ("BiDirectionalProcedureFrequency",
+                   "One message in this many requests a downlink, 0 for none",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TraceDrivenSender::m_bdpFrequency),
+                   MakeUintegerChecker<uint8_t> ())
+    .AddAttribute ("SendPolicy",
+                   "The policy deciding which measurements are sent. "
+                   "A DeadBandSigfoxSendPolicy is used if none is set.",
+                   PointerValue (),
+                   MakePointerAccessor (&TraceDrivenSender::m_policy),
+                   MakePointerChecker<SigfoxSendPolicy> ())
+    .AddTraceSource ("MeasurementSent",
+                     "A measurement was handed to the MAC layer",
+                     MakeTraceSourceAccessor (&TraceDrivenSender::m_measurementSent),
+                     "ns3::sigfox::TraceDrivenSender::MeasurementSentCallback");
+  return tid;
+}
+
+TraceDrivenSender::TraceDrivenSender ()
+  : m_column (0),
+    m_startRow (0),
+    m_chunkRows (4096),
+    m_pktSize (10),
+    m_bdpFrequency (0),
+    m_row (0),
+    m_releasedRow (0),
+    m_pendingValue (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+TraceDrivenSender::~TraceDrivenSender ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+TraceDrivenSender::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_sendEvent.Cancel ();
+  m_trace = 0;
+  m_policy = 0;
+  m_mac = 0;
+  Application::DoDispose ();
+}
+
+void
+TraceDrivenSender::SetSendPolicy (Ptr<SigfoxSendPolicy> policy)
+{
+  m_policy = policy;
+}
+
+void
+TraceDrivenSender::SetColumn (uint32_t column)
+{
+  m_column = column;
+}
+
+void
+TraceDrivenSender::StartApplication (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  // Make sure we have a MAC layer
+  if (m_mac == 0)
+    {
+      // Assumes there's only one device
+      Ptr<SigfoxNetDevice> sigfoxNetDevice = m_node->GetDevice (0)->GetObject<SigfoxNetDevice> ();
+
+      m_mac = sigfoxNetDevice->GetMac ();
+      NS_ASSERT (m_mac != 0);
+    }
+
+  if (m_policy == 0)
+    {
+      m_policy = CreateObject<DeadBandSigfoxSendPolicy> ();
+    }
+
+  m_trace = ColumnarTraceFile::Open (m_traceFile);
+  NS_ABORT_MSG_IF (m_column >= m_trace->GetNColumns (),
+                   "Column " << m_column << " of a trace with " <<
+                   m_trace->GetNColumns () << " columns");
+
+  m_startTime = Simulator::Now ();
+  m_row = m_startRow;
+  m_releasedRow = m_startRow;
+
+  Simulator::Cancel (m_sendEvent);
+  ScheduleNextSend ();
+}
+
+void
+TraceDrivenSender::StopApplication (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  Simulator::Cancel (m_sendEvent);
+}
+
+void
+TraceDrivenSender::ScheduleNextSend (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  uint32_t nRows = m_trace->GetNRows ();
+  while (m_row < nRows)
+    {
+      uint32_t row = m_row++;
+      double value = m_trace->GetValue (m_column, row);
+
+      if (m_row - m_releasedRow >= m_chunkRows)
+        {
+          m_trace->ReleaseRows (m_column, m_releasedRow, m_row);
+          m_releasedRow = m_row;
+        }
+
+      if (m_policy->ShouldSend (value))
+        {
+          Time at = m_startTime +
+            TimeStep (m_trace->GetSamplePeriod ().GetTimeStep () * (row - m_startRow));
+          m_pendingValue = value;
+          m_sendEvent = Simulator::Schedule (at - Simulator::Now (),
+                                             &TraceDrivenSender::SendPacket, this);
+          return;
+        }
+    }
+
+  NS_LOG_DEBUG ("End of column " << m_column << " reached");
+  m_trace->ReleaseRows (m_column, m_releasedRow, nRows);
+  m_releasedRow = nRows;
+}
+
+void
+TraceDrivenSender::SendPacket (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  NS_LOG_DEBUG ("Sending measurement " << m_pendingValue);
+  m_mac->BDPFrequency (m_bdpFrequency);
+  m_mac->Send (Create<Packet> (m_pktSize));
+  m_measurementSent (m_pendingValue);
+
+  ScheduleNextSend ();
+}
+
+} // namespace sigfox
+} // namespace ns3
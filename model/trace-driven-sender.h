@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef TRACE_DRIVEN_SENDER_H
+#define TRACE_DRIVEN_SENDER_H
+
+#include "ns3/application.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/traced-callback.h"
+#include "ns3/sigfox-mac.h"
+#include "ns3/sigfox-send-policy.h"
+#include "ns3/columnar-trace-file.h"
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * An application that replays the measurements of a real sensor, taken from
+ * one column of a ColumnarTraceFile, and sends the ones its
+ * SigfoxSendPolicy picks.
+ *
+ * Measurements are fed to the policy ahead of time, as soon as the previous
+ * message is sent, so that the only event scheduled is the next message
+ * whatever the sampling period of the trace. The rows that were read are
+ * released in chunks, so that the memory used by a replay does not grow
+ * with its length.
+ */
+class TraceDrivenSender : public Application
+{
+public:
+  static TypeId GetTypeId (void);
+
+  TraceDrivenSender ();
+  virtual ~TraceDrivenSender ();
+
+  /**
+   * Set the policy deciding which measurements are sent.
+   *
+   * \param policy The policy, used by this application only.
+   */
+  void SetSendPolicy (Ptr<SigfoxSendPolicy> policy);
+
+  /**
+   * Set the column of the trace this application replays.
+   *
+   * \param column The column.
+   */
+  void SetColumn (uint32_t column);
+
+  /**
+   * Callback signature for MeasurementSent.
+   *
+   * \param value The measurement.
+   */
+  typedef void (*MeasurementSentCallback)(double value);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  virtual void StartApplication (void);
+  virtual void StopApplication (void);
+
+  /**
+   * Feed measurements to the policy until one should be sent, and schedule
+   * the message at the time of that measurement.
+   */
+  void ScheduleNextSend (void);
+
+  /**
+   * Send the measurement picked by ScheduleNextSend.
+   */
+  void SendPacket (void);
+
+  std::string m_traceFile;        //!< The file of the measurements
+  uint32_t m_column;              //!< The series replayed by this application
+  uint32_t m_startRow;            //!< The first measurement replayed
+  uint32_t m_chunkRows;           //!< The number of rows released at once
+  uint8_t m_pktSize;              //!< The payload size of messages
+  uint8_t m_bdpFrequency;         //!< One message in this many requests a downlink
+
+  Ptr<const ColumnarTraceFile> m_trace; //!< The trace, shared with other applications
+  Ptr<SigfoxSendPolicy> m_policy; //!< The policy
+  Ptr<SigfoxMac> m_mac;           //!< The MAC layer of this node
+
+  Time m_startTime;               //!< The time of m_startRow
+  uint32_t m_row;                 //!< The next measurement to feed to the policy
+  uint32_t m_releasedRow;         //!< The rows before this one were released
+  double m_pendingValue;          //!< The measurement of the next message
+
+  EventId m_sendEvent;            //!< The next message
+
+  TracedCallback<double> m_measurementSent; //!< A measurement was sent
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* TRACE_DRIVEN_SENDER_H */
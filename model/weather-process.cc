@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "ns3/weather-process.h"
+#include "ns3/simulator.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+namespace sigfox {
+
+NS_LOG_COMPONENT_DEFINE ("WeatherProcess");
+
+NS_OBJECT_ENSURE_REGISTERED (WeatherProcess);
+
+TypeId
+WeatherProcess::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::WeatherProcess")
+    .SetParent<Object> ()
+    .SetGroupName ("sigfox")
+    .AddConstructor<WeatherProcess> ()
+    .AddAttribute ("Slot",
+                   "The resolution of the weather timeline",
+                   TimeValue (Minutes (1)),
+                   MakeTimeAccessor (&WeatherProcess::m_slot),
+                   MakeTimeChecker (NanoSeconds (1)))
+    .AddAttribute ("MeanRainyDuration",
+                   "The mean duration of a rainy period",
+                   TimeValue (Hours (10)),
+                   MakeTimeAccessor (&WeatherProcess::m_meanRainy),
+                   MakeTimeChecker ())
+    .AddAttribute ("MeanDryDuration",
+                   "The mean duration of a dry period",
+                   TimeValue (Hours (4)),
+                   MakeTimeAccessor (&WeatherProcess::m_meanDry),
+                   MakeTimeChecker ())
+  ;
+  return tid;
+}
+
+WeatherProcess::WeatherProcess ()
+  : m_nSlots (0),
+    m_nextChange (0),
+    m_currentRainy (false)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_initialRV = CreateObject<UniformRandomVariable> ();
+  m_durationRV = CreateObject<ExponentialRandomVariable> ();
+}
+
+WeatherProcess::~WeatherProcess ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+int64_t
+WeatherProcess::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+
+  m_initialRV->SetStream (stream);
+  m_durationRV->SetStream (stream + 1);
+  return 2;
+}
+
+bool
+WeatherProcess::IsRainy (void)
+{
+  return IsRainy (Simulator::Now ());
+}
+
+bool
+WeatherProcess::IsRainy (Time time)
+{
+  NS_ASSERT (!time.IsNegative ());
+
+  uint64_t slot = time.GetTimeStep () / m_slot.GetTimeStep ();
+  if (slot >= m_nSlots)
+    {
+      Extend (slot);
+    }
+  return (m_rainy[slot / 64] >> (slot % 64)) & 1;
+}
+
+void
+WeatherProcess::Extend (uint64_t slot)
+{
+  NS_LOG_FUNCTION (this << slot);
+
+  double slotSeconds = m_slot.GetSeconds ();
+
+  // Periods last at least one slot
+  if (m_nSlots == 0)
+    {
+      // Start from the stationary distribution
+      double pRainy = m_meanRainy.GetSeconds () /
+        (m_meanRainy.GetSeconds () + m_meanDry.GetSeconds ());
+      m_currentRainy = m_initialRV->GetValue () < pRainy;
+      Time mean = m_currentRainy ? m_meanRainy : m_meanDry;
+      m_nextChange = std::max (1.0, std::ceil (m_durationRV->GetValue (mean.GetSeconds (), 0) /
+                                               slotSeconds));
+    }
+
+  // Draw ahead, so that the cost of extending is spread over many queries
+  uint64_t nSlots = std::max (slot + 1, 2 * m_nSlots);
+  m_rainy.resize ((nSlots + 63) / 64, 0);
+
+  for (uint64_t s = m_nSlots; s < nSlots; s++)
+    {
+      while (s >= m_nextChange)
+        {
+          m_currentRainy = !m_currentRainy;
+          Time mean = m_currentRainy ? m_meanRainy : m_meanDry;
+          m_nextChange += std::max (1.0, std::ceil (m_durationRV->GetValue (mean.GetSeconds (), 0) /
+                                                    slotSeconds));
+        }
+      if (m_currentRainy)
+        {
+          m_rainy[s / 64] |= static_cast<uint64_t> (1) << (s % 64);
+        }
+    }
+
+  NS_LOG_DEBUG ("Weather drawn for " << nSlots << " slots");
+  m_nSlots = nSlots;
+}
+
+} // namespace sigfox
+} // namespace ns3
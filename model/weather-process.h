@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef WEATHER_PROCESS_H
+#define WEATHER_PROCESS_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+#include <vector>
+
+namespace ns3 {
+namespace sigfox {
+
+/**
+ * The weather of a region, alternating between rainy and dry periods of
+ * exponentially distributed duration.
+ *
+ * The timeline is drawn ahead of time, with a resolution of one Slot, and
+ * stored as one bit per slot, so that IsRainy only reads a bit. It is
+ * extended as the simulation advances. All the devices that share a
+ * process see the same weather.
+ *
+ * The default durations keep it raining about 71% of the time, like the
+ * Weather Driven Strategy of PeriodicSender did when each device drew the
+ * weather on its own.
+ */
+class WeatherProcess : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  WeatherProcess ();
+  virtual ~WeatherProcess ();
+
+  /**
+   * Get whether it is raining at a given time.
+   *
+   * \param time The time, not earlier than the start of the simulation.
+   * \return Whether it is raining.
+   */
+  bool IsRainy (Time time);
+
+  /**
+   * Get whether it is raining now.
+   */
+  bool IsRainy (void);
+
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by this process.
+   *
+   * \param stream The first stream index to use.
+   * \return The number of stream indices assigned by this process.
+   */
+  int64_t AssignStreams (int64_t stream);
+
+private:
+  /**
+   * Draw the weather of all slots up to a given one.
+   *
+   * \param slot The last slot that must be drawn.
+   */
+  void Extend (uint64_t slot);
+
+  Time m_slot;              //!< The resolution of the timeline
+  Time m_meanRainy;         //!< The mean duration of a rainy period
+  Time m_meanDry;           //!< The mean duration of a dry period
+
+  std::vector<uint64_t> m_rainy; //!< One bit per slot, set if rainy
+  uint64_t m_nSlots;        //!< The number of slots drawn so far
+  uint64_t m_nextChange;    //!< The slot in which the weather changes next
+  bool m_currentRainy;      //!< The weather of the last slot drawn
+
+  Ptr<UniformRandomVariable> m_initialRV;       //!< Draws the initial weather
+  Ptr<ExponentialRandomVariable> m_durationRV;  //!< Draws the durations
+};
+
+} // namespace sigfox
+
+} // namespace ns3
+#endif /* WEATHER_PROCESS_H */